@@ -2770,6 +2770,42 @@ std::string VerilatedContext::profVltFilename() const VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     return m_ns.m_profVltFilename;
 }
+void VerilatedContext::traceStart(uint64_t flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_traceStart = flag;
+}
+void VerilatedContext::traceEnd(uint64_t flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_traceEnd = flag;
+}
+std::vector<std::pair<std::string, bool>> VerilatedContext::traceScopes() const VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    return m_ns.m_traceScopes;
+}
+void VerilatedContext::traceRecorder(uint64_t flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_traceRecorder = flag;
+}
+void VerilatedContext::traceScopeAdd(const std::string& glob, bool include) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_traceScopes.emplace_back(glob, include);
+}
+std::string VerilatedContext::traceTrigger() const VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    return m_ns.m_traceTrigger;
+}
+void VerilatedContext::traceTrigger(const std::string& flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_traceTrigger = flag;
+}
+std::string VerilatedContext::traceProfile() const VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    return m_ns.m_traceProfile;
+}
+void VerilatedContext::traceProfile(const std::string& flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_ns.m_traceProfile = flag;
+}
 void VerilatedContext::solverProgram(const std::string& flag) VL_MT_SAFE {
     const VerilatedLockGuard lock{m_mutex};
     m_ns.m_solverProgram = flag;
@@ -3005,6 +3041,20 @@ void VerilatedContextImp::commandArgVl(const std::string& arg) {
         } else if (commandArgVlUint64(arg, "+verilator+seed+", u64, 1,
                                       std::numeric_limits<int>::max())) {
             randSeed(static_cast<int>(u64));
+        } else if (commandArgVlUint64(arg, "+verilator+trace+end+", u64)) {
+            traceEnd(u64);
+        } else if (commandArgVlString(arg, "+verilator+trace+exclude+", str)) {
+            traceScopeAdd(str, false);
+        } else if (commandArgVlString(arg, "+verilator+trace+profile+", str)) {
+            traceProfile(str);
+        } else if (commandArgVlUint64(arg, "+verilator+trace+recorder+", u64)) {
+            traceRecorder(u64);
+        } else if (commandArgVlString(arg, "+verilator+trace+scope+", str)) {
+            traceScopeAdd(str, true);
+        } else if (commandArgVlUint64(arg, "+verilator+trace+start+", u64)) {
+            traceStart(u64);
+        } else if (commandArgVlString(arg, "+verilator+trace+trigger+", str)) {
+            traceTrigger(str);
         } else if (arg == "+verilator+V") {
             VerilatedImp::versionDump();  // Someday more info too
             VL_FATAL_MT("COMMAND_LINE", 0, "",
@@ -3125,22 +3175,25 @@ void VerilatedContext::scopesDump() const VL_MT_SAFE {
 void VerilatedContextImp::scopeInsert(const VerilatedScope* scopep) VL_MT_SAFE {
     // Slow ok - called once/scope at construction
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
-    const auto it = m_impdatap->m_nameMap.find(scopep->name());
-    if (it == m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.emplace(scopep->name(), scopep);
+    const auto pair = m_impdatap->m_nameHash.emplace(scopep->name(), scopep);
+    if (pair.second) m_impdatap->m_nameMap.emplace(scopep->name(), scopep);
 }
 void VerilatedContextImp::scopeErase(const VerilatedScope* scopep) VL_MT_SAFE {
     // Slow ok - called once/scope at destruction
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     VerilatedImp::userEraseScope(scopep);
-    const auto it = m_impdatap->m_nameMap.find(scopep->name());
-    if (it != m_impdatap->m_nameMap.end()) m_impdatap->m_nameMap.erase(it);
+    const auto it = m_impdatap->m_nameHash.find(scopep->name());
+    // Only erase if this scope was the one inserted under the name
+    if (it == m_impdatap->m_nameHash.end() || it->second != scopep) return;
+    m_impdatap->m_nameHash.erase(it);
+    m_impdatap->m_nameMap.erase(scopep->name());
 }
 const VerilatedScope* VerilatedContext::scopeFind(const char* namep) const VL_MT_SAFE {
     // Thread save only assuming this is called only after model construction completed
     const VerilatedLockGuard lock{m_impdatap->m_nameMutex};
     // If too slow, can assume this is only VL_MT_SAFE_POSINIT
-    const auto& it = m_impdatap->m_nameMap.find(namep);
-    if (VL_UNLIKELY(it == m_impdatap->m_nameMap.end())) return nullptr;
+    const auto& it = m_impdatap->m_nameHash.find(namep);
+    if (VL_UNLIKELY(it == m_impdatap->m_nameHash.end())) return nullptr;
     return it->second;
 }
 const VerilatedScopeNameMap* VerilatedContext::scopeNameMap() VL_MT_SAFE {
@@ -3192,6 +3245,15 @@ VerilatedSyms::~VerilatedSyms() {
     delete __Vm_evalMsgQp;
 }
 
+void VerilatedSyms::varsInitGuts() VL_MT_SAFE_EXCLUDES(m_varsMutex) {
+    // Slow ok - called once per model, the first time a public variable is looked up.
+    // Deferred from construction as large models rarely look up most variables.
+    const VerilatedLockGuard lock{m_varsMutex};
+    if (m_varsDone.load(std::memory_order_relaxed)) return;  // Another thread won
+    varsSetup();
+    m_varsDone.store(true, std::memory_order_release);
+}
+
 //===========================================================================
 // Verilated:: Methods
 
@@ -3535,8 +3597,17 @@ void VerilatedScope::varInsert(const char* namep, void* datap, bool isParam,
     m_varsp->emplace(namep, var);
 }
 
+void VerilatedScope::varDirtyIndex(const char* namep, int32_t index) VL_MT_UNSAFE {
+    // Called after varInsert, for variables with a VPI value change flag
+    // Called from VerilatedSyms::varsSetup, so must not use varFind
+    if (VL_UNLIKELY(!m_varsp)) return;
+    const auto it = m_varsp->find(namep);
+    if (VL_LIKELY(it != m_varsp->end())) it->second.m_dirtyIndex = index;
+}
+
 // cppcheck-suppress unusedFunction  // Used by applications
 VerilatedVar* VerilatedScope::varFind(const char* namep) const VL_MT_SAFE_POSTINIT {
+    m_symsp->varsInit();
     if (VL_LIKELY(m_varsp)) {
         const auto it = m_varsp->find(namep);
         if (VL_LIKELY(it != m_varsp->end())) return &(it->second);
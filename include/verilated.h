@@ -411,6 +411,13 @@ protected:
         std::string m_profExecFilename;  // +prof+exec+file filename
         std::string m_profVltFilename;  // +prof+vlt filename
         std::string m_solverProgram;  // SMT solver program
+        uint64_t m_traceStart = 0;  // +trace+start time
+        uint64_t m_traceEnd = std::numeric_limits<uint64_t>::max();  // +trace+end time
+        // +trace+scope (include = true) and +trace+exclude (include = false) globs
+        std::vector<std::pair<std::string, bool>> m_traceScopes;
+        std::string m_traceTrigger;  // +trace+trigger signal
+        uint64_t m_traceRecorder = 0;  // +trace+recorder dumps
+        std::string m_traceProfile;  // +trace+profile filename
         VlOs::DeltaCpuTime m_cpuTimeStart{false};  // CPU time, starts when create first model
         VlOs::DeltaWallTime m_wallTimeStart{false};  // Wall time, starts when create first model
         std::vector<traceBaseModelCb_t> m_traceBaseModelCbs;  // Callbacks to traceRegisterModel
@@ -647,6 +654,20 @@ public:
     std::string profVltFilename() const VL_MT_SAFE;
     void profVltFilename(const std::string& flag) VL_MT_SAFE;
 
+    // Internal: +verilator+trace+ settings, applied when added to a trace file
+    uint64_t traceStart() const VL_MT_SAFE { return m_ns.m_traceStart; }
+    void traceStart(uint64_t flag) VL_MT_SAFE;
+    uint64_t traceEnd() const VL_MT_SAFE { return m_ns.m_traceEnd; }
+    void traceEnd(uint64_t flag) VL_MT_SAFE;
+    std::vector<std::pair<std::string, bool>> traceScopes() const VL_MT_SAFE;
+    void traceScopeAdd(const std::string& glob, bool include) VL_MT_SAFE;
+    std::string traceTrigger() const VL_MT_SAFE;
+    void traceTrigger(const std::string& flag) VL_MT_SAFE;
+    uint64_t traceRecorder() const VL_MT_SAFE { return m_ns.m_traceRecorder; }
+    void traceRecorder(uint64_t flag) VL_MT_SAFE;
+    std::string traceProfile() const VL_MT_SAFE;
+    void traceProfile(const std::string& flag) VL_MT_SAFE;
+
     // Internal: SMT solver program
     std::string solverProgram() const VL_MT_SAFE;
     void solverProgram(const std::string& flag) VL_MT_SAFE;
@@ -677,11 +698,30 @@ public:  // But for internal use only
     // Keep first so is at zero offset for fastest code
     VerilatedContext* const _vm_contextp__;  // Context for current model
     VerilatedEvalMsgQueue* __Vm_evalMsgQp;
+    CData* __Vm_vpiDirtyp = nullptr;  // VPI value change flags (--vpi-dirty), nullptr = none
+    uint32_t __Vm_vpiDirtySize = 0;  // Number of VPI value change flags
+
+private:
+    VerilatedMutex m_varsMutex;  // Protect public variable table construction
+    std::atomic<bool> m_varsDone{false};  // Public variables have been inserted into scopes
+
+public:
     explicit VerilatedSyms(VerilatedContext* contextp);  // Pass null for default context
     ~VerilatedSyms();
     VL_UNCOPYABLE(VerilatedSyms);
 
     virtual const char* name() const = 0;
+    // Insert public variables into their scopes, on first variable lookup
+    void varsInit() VL_MT_SAFE {
+        if (VL_UNLIKELY(!m_varsDone.load(std::memory_order_acquire))) varsInitGuts();
+    }
+
+protected:
+    // Generated models override to call VerilatedScope::varInsert for each public variable
+    virtual void varsSetup() {}
+
+private:
+    void varsInitGuts() VL_MT_SAFE_EXCLUDES(m_varsMutex);
 };
 
 //===========================================================================
@@ -716,6 +756,7 @@ public:  // But internals only - called from verilated modules, VerilatedSyms
     void exportInsert(int finalize, const char* namep, void* cb) VL_MT_UNSAFE;
     void varInsert(const char* namep, void* datap, bool isParam, VerilatedVarType vltype,
                    int vlflags, int udims, int pdims, ...) VL_MT_UNSAFE;
+    void varDirtyIndex(const char* namep, int32_t index) VL_MT_UNSAFE;
     // ACCESSORS
     const char* name() const VL_MT_SAFE_POSTINIT { return m_namep; }
     const char* identifier() const VL_MT_SAFE_POSTINIT { return m_identifierp; }
@@ -723,7 +764,10 @@ public:  // But internals only - called from verilated modules, VerilatedSyms
     int8_t timeunit() const VL_MT_SAFE_POSTINIT { return m_timeunit; }
     VerilatedSyms* symsp() const VL_MT_SAFE_POSTINIT { return m_symsp; }
     VerilatedVar* varFind(const char* namep) const VL_MT_SAFE_POSTINIT;
-    VerilatedVarNameMap* varsp() const VL_MT_SAFE_POSTINIT { return m_varsp; }
+    VerilatedVarNameMap* varsp() const VL_MT_SAFE_POSTINIT {
+        m_symsp->varsInit();
+        return m_varsp;
+    }
     void scopeDump() const;
     void* exportFindError(int funcnum) const VL_MT_SAFE;
     static void* exportFindNullError(int funcnum) VL_MT_SAFE;
@@ -74,6 +74,7 @@ VerilatedFst::~VerilatedFst() {
     if (m_fst) fstWriterClose(m_fst);
     if (m_symbolp) VL_DO_CLEAR(delete[] m_symbolp, m_symbolp = nullptr);
     if (m_strbufp) VL_DO_CLEAR(delete[] m_strbufp, m_strbufp = nullptr);
+    for (std::string*& recordsp : m_freeBuffers) VL_DO_CLEAR(delete recordsp, recordsp = nullptr);
 }
 
 void VerilatedFst::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
@@ -296,7 +297,18 @@ void VerilatedFst::declDouble(uint32_t code, uint32_t fidx, const char* name, in
 
 VerilatedFst::Buffer* VerilatedFst::getTraceBuffer(uint32_t fidx) {
     if (offload()) return new OffloadBuffer{*this};
-    return new Buffer{*this};
+    VerilatedFst::Buffer* const bufp = new Buffer{*this};
+    if (parallel()) {
+        // Note: This is called from VerilatedFst::dump, which already holds the lock
+        // Each buffer records its changes separately, as the FST writer is not thread safe
+        if (m_freeBuffers.empty()) {
+            bufp->m_recordsp = new std::string;
+        } else {
+            bufp->m_recordsp = m_freeBuffers.back();
+            m_freeBuffers.pop_back();
+        }
+    }
+    return bufp;
 }
 
 void VerilatedFst::commitTraceBuffer(VerilatedFst::Buffer* bufp) {
@@ -307,6 +319,26 @@ void VerilatedFst::commitTraceBuffer(VerilatedFst::Buffer* bufp) {
             return;  // Buffer will be deleted by the offload thread
         }
     }
+    if (parallel()) {
+        // Note: This is called from VerilatedFst::dump, which already holds the lock
+        // Buffers are committed in the order of the trace functions, so the
+        // merged changes are the same as with sequential tracing
+        std::string* const recordsp = bufp->m_recordsp;
+        const char* recordp = recordsp->data();
+        const char* const endp = recordp + recordsp->size();
+        if (recordp != endp) emitTimeChangeMaybe();
+        while (recordp < endp) {
+            uint32_t code;
+            uint32_t size;
+            std::memcpy(&code, recordp, sizeof(code));
+            std::memcpy(&size, recordp + sizeof(code), sizeof(size));
+            recordp += sizeof(code) + sizeof(size);
+            fstWriterEmitValueChange(m_fst, m_symbolp[code], recordp);
+            recordp += size;
+        }
+        recordsp->clear();
+        m_freeBuffers.push_back(recordsp);
+    }
     delete bufp;
 }
 
@@ -328,9 +360,24 @@ void VerilatedFst::configure(const VerilatedTraceConfig& config) {
 // verilated_trace_imp.h, which is included in this file at the top),
 // so always inline them.
 
+VL_ATTR_ALWINLINE
+char* VerilatedFstBuffer::record(uint32_t code, size_t size) {
+    const uint32_t size32 = static_cast<uint32_t>(size);
+    const size_t pos = m_recordsp->size();
+    m_recordsp->resize(pos + sizeof(code) + sizeof(size32) + size);
+    char* const recordp = &(*m_recordsp)[pos];
+    std::memcpy(recordp, &code, sizeof(code));
+    std::memcpy(recordp + sizeof(code), &size32, sizeof(size32));
+    return recordp + sizeof(code) + sizeof(size32);
+}
+
 VL_ATTR_ALWINLINE
 void VerilatedFstBuffer::emitEvent(uint32_t code) {
     VL_DEBUG_IFDEF(assert(m_symbolp[code]););
+    if (m_recordsp) {
+        *record(code, 1) = '1';
+        return;
+    }
     m_owner.emitTimeChangeMaybe();
     fstWriterEmitValueChange(m_fst, m_symbolp[code], "1");
 }
@@ -338,6 +385,10 @@ void VerilatedFstBuffer::emitEvent(uint32_t code) {
 VL_ATTR_ALWINLINE
 void VerilatedFstBuffer::emitBit(uint32_t code, CData newval) {
     VL_DEBUG_IFDEF(assert(m_symbolp[code]););
+    if (m_recordsp) {
+        *record(code, 1) = newval ? '1' : '0';
+        return;
+    }
     m_owner.emitTimeChangeMaybe();
     fstWriterEmitValueChange(m_fst, m_symbolp[code], newval ? "1" : "0");
 }
@@ -346,6 +397,10 @@ VL_ATTR_ALWINLINE
 void VerilatedFstBuffer::emitCData(uint32_t code, CData newval, int bits) {
     char buf[VL_BYTESIZE];
     VL_DEBUG_IFDEF(assert(m_symbolp[code]););
+    if (m_recordsp) {
+        cvtCDataToStr(record(code, VL_BYTESIZE), newval << (VL_BYTESIZE - bits));
+        return;
+    }
     cvtCDataToStr(buf, newval << (VL_BYTESIZE - bits));
     m_owner.emitTimeChangeMaybe();
     fstWriterEmitValueChange(m_fst, m_symbolp[code], buf);
@@ -355,6 +410,10 @@ VL_ATTR_ALWINLINE
 void VerilatedFstBuffer::emitSData(uint32_t code, SData newval, int bits) {
     char buf[VL_SHORTSIZE];
     VL_DEBUG_IFDEF(assert(m_symbolp[code]););
+    if (m_recordsp) {
+        cvtSDataToStr(record(code, VL_SHORTSIZE), newval << (VL_SHORTSIZE - bits));
+        return;
+    }
     cvtSDataToStr(buf, newval << (VL_SHORTSIZE - bits));
     m_owner.emitTimeChangeMaybe();
     fstWriterEmitValueChange(m_fst, m_symbolp[code], buf);
@@ -364,6 +423,10 @@ VL_ATTR_ALWINLINE
 void VerilatedFstBuffer::emitIData(uint32_t code, IData newval, int bits) {
     char buf[VL_IDATASIZE];
     VL_DEBUG_IFDEF(assert(m_symbolp[code]););
+    if (m_recordsp) {
+        cvtIDataToStr(record(code, VL_IDATASIZE), newval << (VL_IDATASIZE - bits));
+        return;
+    }
     cvtIDataToStr(buf, newval << (VL_IDATASIZE - bits));
     m_owner.emitTimeChangeMaybe();
     fstWriterEmitValueChange(m_fst, m_symbolp[code], buf);
@@ -373,6 +436,10 @@ VL_ATTR_ALWINLINE
 void VerilatedFstBuffer::emitQData(uint32_t code, QData newval, int bits) {
     char buf[VL_QUADSIZE];
     VL_DEBUG_IFDEF(assert(m_symbolp[code]););
+    if (m_recordsp) {
+        cvtQDataToStr(record(code, VL_QUADSIZE), newval << (VL_QUADSIZE - bits));
+        return;
+    }
     cvtQDataToStr(buf, newval << (VL_QUADSIZE - bits));
     m_owner.emitTimeChangeMaybe();
     fstWriterEmitValueChange(m_fst, m_symbolp[code], buf);
@@ -381,7 +448,10 @@ void VerilatedFstBuffer::emitQData(uint32_t code, QData newval, int bits) {
 VL_ATTR_ALWINLINE
 void VerilatedFstBuffer::emitWData(uint32_t code, const WData* newvalp, int bits) {
     int words = VL_WORDS_I(bits);
-    char* wp = m_strbufp;
+    // The shared string buffer is not usable in parallel, so convert into the record
+    // (the first conversion may write up to a word beyond 'bits')
+    char* const strp = m_recordsp ? record(code, bits + VL_EDATASIZE) : m_strbufp;
+    char* wp = strp;
     // Convert the most significant word
     const int bitsInMSW = VL_BITBIT_E(bits) ? VL_BITBIT_E(bits) : VL_EDATASIZE;
     cvtEDataToStr(wp, newvalp[--words] << (VL_EDATASIZE - bitsInMSW));
@@ -391,12 +461,17 @@ void VerilatedFstBuffer::emitWData(uint32_t code, const WData* newvalp, int bits
         cvtEDataToStr(wp, newvalp[--words]);
         wp += VL_EDATASIZE;
     }
+    if (m_recordsp) return;
     m_owner.emitTimeChangeMaybe();
-    fstWriterEmitValueChange(m_fst, m_symbolp[code], m_strbufp);
+    fstWriterEmitValueChange(m_fst, m_symbolp[code], strp);
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedFstBuffer::emitDouble(uint32_t code, double newval) {
+    if (m_recordsp) {
+        std::memcpy(record(code, sizeof(newval)), &newval, sizeof(newval));
+        return;
+    }
     m_owner.emitTimeChangeMaybe();
     fstWriterEmitValueChange(m_fst, m_symbolp[code], &newval);
 }
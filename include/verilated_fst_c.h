@@ -60,6 +60,9 @@ private:
 
     bool m_useFstWriterThread = false;  // Whether to use the separate FST writer thread
 
+    // Value change record buffers of parallel tracing available for reuse
+    std::vector<std::string*> m_freeBuffers;
+
     // Prefixes to add to signal names/scope types
     std::vector<std::pair<std::string, VerilatedTracePrefixType>> m_prefixStack{
         {"", VerilatedTracePrefixType::SCOPE_MODULE}};
@@ -150,6 +153,20 @@ template <>
 void VerilatedFst::Super::set_time_resolution(const std::string& unit);
 template <>
 void VerilatedFst::Super::dumpvars(int level, const std::string& hier);
+template <>
+void VerilatedFst::Super::dumpScope(const std::string& glob, bool include);
+template <>
+void VerilatedFst::Super::dumpWindow(uint64_t start, uint64_t end);
+template <>
+void VerilatedFst::Super::dumpTrigger(const std::string& signal);
+template <>
+void VerilatedFst::Super::dumpOn(bool flag);
+template <>
+void VerilatedFst::Super::dumpRecorder(uint64_t dumps);
+template <>
+void VerilatedFst::Super::dumpRecorderWrite();
+template <>
+void VerilatedFst::Super::dumpProfile(const std::string& filename);
 #endif
 
 //=============================================================================
@@ -170,12 +187,18 @@ class VerilatedFstBuffer VL_NOT_FINAL {
     const vlFstHandle* const m_symbolp = m_owner.m_symbolp;
     // String buffer long enough to hold maxBits() chars
     char* const m_strbufp = m_owner.m_strbufp;
+    // In parallel mode, value changes are recorded here by the worker thread,
+    // then written to the FST file in 'commitTraceBuffer' (set up in 'getTraceBuffer')
+    std::string* m_recordsp = nullptr;
 
     // CONSTRUCTOR
     explicit VerilatedFstBuffer(VerilatedFst& owner)
         : m_owner{owner} {}
     virtual ~VerilatedFstBuffer() = default;
 
+    // Append a value change record with 'size' value bytes, return pointer to the value
+    char* record(uint32_t code, size_t size);
+
     //=========================================================================
     // Implementation of VerilatedTraceBuffer interface
 
@@ -254,6 +277,25 @@ public:
     void dumpvars(int level, const std::string& hier) VL_MT_SAFE {
         m_sptrace.dumpvars(level, hier);
     }
+    // Trace (include = true) or do not trace (include = false) the signals
+    // under scopes matching the glob (with '*' and '?'). Call before open().
+    void dumpScope(const std::string& glob, bool include) VL_MT_SAFE {
+        m_sptrace.dumpScope(glob, include);
+    }
+    // Only dump at times within [start, end]; may be called multiple times
+    void dumpWindow(uint64_t start, uint64_t end) VL_MT_SAFE { m_sptrace.dumpWindow(start, end); }
+    // Only dump when the given hierarchical signal is non-zero
+    void dumpTrigger(const std::string& signal) VL_MT_SAFE { m_sptrace.dumpTrigger(signal); }
+    // Enable (default) or disable dumps, e.g. from an external trigger
+    void dumpOn(bool flag) VL_MT_SAFE { m_sptrace.dumpOn(flag); }
+    // Keep only the last dumps in memory, and write them on an error or
+    // dumpRecorderWrite(); see VerilatedTrace::dumpRecorder
+    void dumpRecorder(uint64_t dumps) VL_MT_SAFE { m_sptrace.dumpRecorder(dumps); }
+    // Write the dumps kept by dumpRecorder() to the file
+    void dumpRecorderWrite() VL_MT_SAFE { m_sptrace.dumpRecorderWrite(); }
+    // Write a report of the trace cost of each signal and scope to the
+    // file on close; see VerilatedTrace::dumpProfile
+    void dumpProfile(const std::string& filename) VL_MT_SAFE { m_sptrace.dumpProfile(filename); }
 
     // Internal class access
     VerilatedFst* spTrace() { return &m_sptrace; }
@@ -28,6 +28,8 @@
 #error "verilated_funcs.h should only be included by verilated.h"
 #endif
 
+#include "verilated_intrinsics.h"
+
 #include <string>
 
 //=========================================================================
@@ -648,6 +650,116 @@ static inline WDataOutP VL_EXTENDS_WW(int obits, int lbits, WDataOutP owp,
     return VL_MEMCPY_W(owp, lwp, lwords - 1);
 }
 
+//===================================================================
+// Vector helpers for wide operations, internal usage
+//
+// VlWide data is only EData aligned, so unaligned loads and stores are used.
+// Functions using these handle VL_SIMD_WORDS at a time, and finish the
+// remaining words with the scalar loop.
+
+// clang-format off
+#if defined(VL_HAVE_AVX2)
+# define VL_SIMD_WORDS 8
+using VlSimdVec = __m256i;
+static inline VlSimdVec _vl_simd_load(const EData* p) VL_PURE {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+}
+static inline void _vl_simd_store(EData* p, VlSimdVec v) VL_MT_SAFE {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v);
+}
+static inline VlSimdVec _vl_simd_and(VlSimdVec a, VlSimdVec b) VL_PURE {
+    return _mm256_and_si256(a, b);
+}
+static inline VlSimdVec _vl_simd_or(VlSimdVec a, VlSimdVec b) VL_PURE {
+    return _mm256_or_si256(a, b);
+}
+static inline VlSimdVec _vl_simd_xor(VlSimdVec a, VlSimdVec b) VL_PURE {
+    return _mm256_xor_si256(a, b);
+}
+static inline VlSimdVec _vl_simd_ones() VL_PURE { return _mm256_set1_epi32(-1); }
+static inline VlSimdVec _vl_simd_zero() VL_PURE { return _mm256_setzero_si256(); }
+static inline bool _vl_simd_is_zero(VlSimdVec v) VL_PURE { return _mm256_testz_si256(v, v); }
+// Shift each lane by 0..31 bits
+static inline VlSimdVec _vl_simd_sll(VlSimdVec v, int shift) VL_PURE {
+    return _mm256_sll_epi32(v, _mm_cvtsi32_si128(shift));
+}
+static inline VlSimdVec _vl_simd_srl(VlSimdVec v, int shift) VL_PURE {
+    return _mm256_srl_epi32(v, _mm_cvtsi32_si128(shift));
+}
+// Fold upper half onto lower half, for reductions
+static inline __m128i _vl_simd_fold_or(VlSimdVec v) VL_PURE {
+    return _mm_or_si128(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+}
+static inline __m128i _vl_simd_fold_xor(VlSimdVec v) VL_PURE {
+    return _mm_xor_si128(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+}
+#elif defined(VL_HAVE_SSE2)
+# define VL_SIMD_WORDS 4
+using VlSimdVec = __m128i;
+static inline VlSimdVec _vl_simd_load(const EData* p) VL_PURE {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+static inline void _vl_simd_store(EData* p, VlSimdVec v) VL_MT_SAFE {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);
+}
+static inline VlSimdVec _vl_simd_and(VlSimdVec a, VlSimdVec b) VL_PURE {
+    return _mm_and_si128(a, b);
+}
+static inline VlSimdVec _vl_simd_or(VlSimdVec a, VlSimdVec b) VL_PURE {
+    return _mm_or_si128(a, b);
+}
+static inline VlSimdVec _vl_simd_xor(VlSimdVec a, VlSimdVec b) VL_PURE {
+    return _mm_xor_si128(a, b);
+}
+static inline VlSimdVec _vl_simd_ones() VL_PURE { return _mm_set1_epi32(-1); }
+static inline VlSimdVec _vl_simd_zero() VL_PURE { return _mm_setzero_si128(); }
+static inline bool _vl_simd_is_zero(VlSimdVec v) VL_PURE {
+    return _mm_movemask_epi8(_mm_cmpeq_epi32(v, _mm_setzero_si128())) == 0xffff;
+}
+// Shift each lane by 0..31 bits
+static inline VlSimdVec _vl_simd_sll(VlSimdVec v, int shift) VL_PURE {
+    return _mm_sll_epi32(v, _mm_cvtsi32_si128(shift));
+}
+static inline VlSimdVec _vl_simd_srl(VlSimdVec v, int shift) VL_PURE {
+    return _mm_srl_epi32(v, _mm_cvtsi32_si128(shift));
+}
+static inline __m128i _vl_simd_fold_or(VlSimdVec v) VL_PURE { return v; }
+static inline __m128i _vl_simd_fold_xor(VlSimdVec v) VL_PURE { return v; }
+#endif
+// clang-format on
+
+#ifdef VL_SIMD_WORDS
+// Combine all lanes of a vector into one word using OR or XOR
+static inline EData _vl_simd_reduce_or(VlSimdVec v) VL_PURE {
+    __m128i x = _vl_simd_fold_or(v);
+    x = _mm_or_si128(x, _mm_srli_si128(x, 8));
+    x = _mm_or_si128(x, _mm_srli_si128(x, 4));
+    return static_cast<EData>(_mm_cvtsi128_si32(x));
+}
+static inline EData _vl_simd_reduce_xor(VlSimdVec v) VL_PURE {
+    __m128i x = _vl_simd_fold_xor(v);
+    x = _mm_xor_si128(x, _mm_srli_si128(x, 8));
+    x = _mm_xor_si128(x, _mm_srli_si128(x, 4));
+    return static_cast<EData>(_mm_cvtsi128_si32(x));
+}
+#endif
+
+// Internal usage, shift pairs of words right: for i < words,
+// owp[i] = (lwp[i] >> shift) | (lwp[i + 1] << (32 - shift)), where 0 < shift < 32.
+// Works in place when owp <= lwp.
+static inline void _vl_shiftr_pairs_w(int words, EData* owp, const EData* lwp,
+                                      int shift) VL_MT_SAFE {
+    int i = 0;
+#ifdef VL_SIMD_WORDS
+    for (; i + VL_SIMD_WORDS <= words; i += VL_SIMD_WORDS) {
+        _vl_simd_store(owp + i, _vl_simd_or(_vl_simd_srl(_vl_simd_load(lwp + i), shift),
+                                            _vl_simd_sll(_vl_simd_load(lwp + i + 1),
+                                                         VL_EDATASIZE - shift)));
+    }
+#endif
+    for (; i < words; ++i) owp[i] = (lwp[i] >> shift) | (lwp[i + 1] << (VL_EDATASIZE - shift));
+}
+
 //===================================================================
 // REDUCTION OPERATORS
 
@@ -735,7 +847,17 @@ static inline IData VL_REDXOR_64(QData r) VL_PURE {
 }
 static inline IData VL_REDXOR_W(int words, WDataInP const lwp) VL_PURE {
     EData r = lwp[0];
-    for (int i = 1; i < words; ++i) r ^= lwp[i];
+    int i = 1;
+#ifdef VL_SIMD_WORDS
+    if (words >= VL_SIMD_WORDS) {
+        VlSimdVec acc = _vl_simd_load(lwp);
+        for (i = VL_SIMD_WORDS; i + VL_SIMD_WORDS <= words; i += VL_SIMD_WORDS) {
+            acc = _vl_simd_xor(acc, _vl_simd_load(lwp + i));
+        }
+        r = _vl_simd_reduce_xor(acc);
+    }
+#endif
+    for (; i < words; ++i) r ^= lwp[i];
     return VL_REDXOR_32(r);
 }
 
@@ -870,30 +992,64 @@ static inline IData VL_MOSTSETBITP1_W(int words, WDataInP const lwp) VL_PURE {
 // EMIT_RULE: VL_AND:  oclean=lclean||rclean; obits=lbits; lbits==rbits;
 static inline WDataOutP VL_AND_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] & rwp[i]);
+    int i = 0;
+#ifdef VL_SIMD_WORDS
+    for (; i + VL_SIMD_WORDS <= words; i += VL_SIMD_WORDS) {
+        _vl_simd_store(owp + i, _vl_simd_and(_vl_simd_load(lwp + i), _vl_simd_load(rwp + i)));
+    }
+#endif
+    for (; (i < words); ++i) owp[i] = (lwp[i] & rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_OR:   oclean=lclean&&rclean; obits=lbits; lbits==rbits;
 static inline WDataOutP VL_OR_W(int words, WDataOutP owp, WDataInP const lwp,
                                 WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] | rwp[i]);
+    int i = 0;
+#ifdef VL_SIMD_WORDS
+    for (; i + VL_SIMD_WORDS <= words; i += VL_SIMD_WORDS) {
+        _vl_simd_store(owp + i, _vl_simd_or(_vl_simd_load(lwp + i), _vl_simd_load(rwp + i)));
+    }
+#endif
+    for (; (i < words); ++i) owp[i] = (lwp[i] | rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_CHANGEXOR:  oclean=1; obits=32; lbits==rbits;
 static inline IData VL_CHANGEXOR_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
     IData od = 0;
-    for (int i = 0; (i < words); ++i) od |= (lwp[i] ^ rwp[i]);
+    int i = 0;
+#ifdef VL_SIMD_WORDS
+    if (words >= VL_SIMD_WORDS) {
+        VlSimdVec acc = _vl_simd_zero();
+        for (; i + VL_SIMD_WORDS <= words; i += VL_SIMD_WORDS) {
+            acc = _vl_simd_or(acc, _vl_simd_xor(_vl_simd_load(lwp + i), _vl_simd_load(rwp + i)));
+        }
+        od = _vl_simd_reduce_or(acc);
+    }
+#endif
+    for (; (i < words); ++i) od |= (lwp[i] ^ rwp[i]);
     return od;
 }
 // EMIT_RULE: VL_XOR:  oclean=lclean&&rclean; obits=lbits; lbits==rbits;
 static inline WDataOutP VL_XOR_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; (i < words); ++i) owp[i] = (lwp[i] ^ rwp[i]);
+    int i = 0;
+#ifdef VL_SIMD_WORDS
+    for (; i + VL_SIMD_WORDS <= words; i += VL_SIMD_WORDS) {
+        _vl_simd_store(owp + i, _vl_simd_xor(_vl_simd_load(lwp + i), _vl_simd_load(rwp + i)));
+    }
+#endif
+    for (; (i < words); ++i) owp[i] = (lwp[i] ^ rwp[i]);
     return owp;
 }
 // EMIT_RULE: VL_NOT:  oclean=dirty; obits=lbits;
 static inline WDataOutP VL_NOT_W(int words, WDataOutP owp, WDataInP const lwp) VL_MT_SAFE {
-    for (int i = 0; i < words; ++i) owp[i] = ~(lwp[i]);
+    int i = 0;
+#ifdef VL_SIMD_WORDS
+    for (; i + VL_SIMD_WORDS <= words; i += VL_SIMD_WORDS) {
+        _vl_simd_store(owp + i, _vl_simd_xor(_vl_simd_load(lwp + i), _vl_simd_ones()));
+    }
+#endif
+    for (; i < words; ++i) owp[i] = ~(lwp[i]);
     return owp;
 }
 
@@ -906,17 +1062,10 @@ static inline WDataOutP VL_NOT_W(int words, WDataOutP owp, WDataInP const lwp) V
 // EMIT_RULE: VL_GT:  oclean=clean; lclean==clean; rclean==clean; obits=1; lbits==rbits;
 // EMIT_RULE: VL_GTE: oclean=clean; lclean==clean; rclean==clean; obits=1; lbits==rbits;
 // EMIT_RULE: VL_LTE: oclean=clean; lclean==clean; rclean==clean; obits=1; lbits==rbits;
-#define VL_NEQ_W(words, lwp, rwp) (!VL_EQ_W(words, lwp, rwp))
-#define VL_LT_W(words, lwp, rwp) (_vl_cmp_w(words, lwp, rwp) < 0)
-#define VL_LTE_W(words, lwp, rwp) (_vl_cmp_w(words, lwp, rwp) <= 0)
-#define VL_GT_W(words, lwp, rwp) (_vl_cmp_w(words, lwp, rwp) > 0)
-#define VL_GTE_W(words, lwp, rwp) (_vl_cmp_w(words, lwp, rwp) >= 0)
 
 // Output clean, <lhs> AND <rhs> MUST BE CLEAN
 static inline IData VL_EQ_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
-    EData nequal = 0;
-    for (int i = 0; (i < words); ++i) nequal |= (lwp[i] ^ rwp[i]);
-    return (nequal == 0);
+    return (VL_CHANGEXOR_W(words, lwp, rwp) == 0);
 }
 
 // Internal usage
@@ -928,6 +1077,23 @@ static inline int _vl_cmp_w(int words, WDataInP const lwp, WDataInP const rwp) V
     return 0;  // ==
 }
 
+// Functions, not macros, so the fixed-width templates below can share the names
+static inline IData VL_NEQ_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return !VL_EQ_W(words, lwp, rwp);
+}
+static inline IData VL_LT_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return _vl_cmp_w(words, lwp, rwp) < 0;
+}
+static inline IData VL_LTE_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return _vl_cmp_w(words, lwp, rwp) <= 0;
+}
+static inline IData VL_GT_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return _vl_cmp_w(words, lwp, rwp) > 0;
+}
+static inline IData VL_GTE_W(int words, WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return _vl_cmp_w(words, lwp, rwp) >= 0;
+}
+
 #define VL_LTS_IWW(lbits, lwp, rwp) (_vl_cmps_w(lbits, lwp, rwp) < 0)
 #define VL_LTES_IWW(lbits, lwp, rwp) (_vl_cmps_w(lbits, lwp, rwp) <= 0)
 #define VL_GTS_IWW(lbits, lwp, rwp) (_vl_cmps_w(lbits, lwp, rwp) > 0)
@@ -1033,11 +1199,24 @@ static inline QData VL_MODDIV_QQQ(int lbits, QData lhs, QData rhs) {
 }
 #define VL_MODDIV_WWW(lbits, owp, lwp, rwp) (_vl_moddiv_w(lbits, owp, lwp, rwp, 1))
 
-static inline WDataOutP VL_ADD_W(int words, WDataOutP owp, WDataInP const lwp,
-                                 WDataInP const rwp) VL_MT_SAFE {
-    QData carry = 0;
-    for (int i = 0; i < words; ++i) {
-        carry = carry + static_cast<QData>(lwp[i]) + static_cast<QData>(rwp[i]);
+// Internal usage, lhs + (invert ? ~rhs : rhs) + carry
+static inline WDataOutP _vl_add_w(int words, WDataOutP owp, WDataInP const lwp,
+                                  WDataInP const rwp, EData invert, QData carry) VL_MT_SAFE {
+    int i = 0;
+    // Two words at a time, halving the carry chain; the carry out of
+    // the 64-bit add is detected by unsigned overflow
+    for (; i + 2 <= words; i += 2) {
+        const QData lhs = static_cast<QData>(lwp[i]) | (static_cast<QData>(lwp[i + 1]) << 32ULL);
+        const QData rhs = static_cast<QData>(rwp[i] ^ invert)
+                          | (static_cast<QData>(rwp[i + 1] ^ invert) << 32ULL);
+        const QData sum = lhs + rhs;
+        const QData out = sum + carry;
+        carry = static_cast<QData>(sum < lhs) | static_cast<QData>(out < sum);
+        owp[i] = static_cast<EData>(out);
+        owp[i + 1] = static_cast<EData>(out >> 32ULL);
+    }
+    for (; i < words; ++i) {
+        carry = carry + static_cast<QData>(lwp[i]) + static_cast<QData>(rwp[i] ^ invert);
         owp[i] = (carry & 0xffffffffULL);
         carry = (carry >> 32ULL) & 0xffffffffULL;
     }
@@ -1045,33 +1224,65 @@ static inline WDataOutP VL_ADD_W(int words, WDataOutP owp, WDataInP const lwp,
     return owp;
 }
 
+static inline WDataOutP VL_ADD_W(int words, WDataOutP owp, WDataInP const lwp,
+                                 WDataInP const rwp) VL_MT_SAFE {
+    return _vl_add_w(words, owp, lwp, rwp, 0, 0);
+}
+
 static inline WDataOutP VL_SUB_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
-    QData carry = 0;
-    for (int i = 0; i < words; ++i) {
-        carry = (carry + static_cast<QData>(lwp[i])
-                 + static_cast<QData>(static_cast<IData>(~rwp[i])));
-        if (i == 0) ++carry;  // Negation of rwp
-        owp[i] = (carry & 0xffffffffULL);
-        carry = (carry >> 32ULL) & 0xffffffffULL;
-    }
-    // Last output word is dirty
-    return owp;
+    // Negation of rwp is ~rwp + 1
+    return _vl_add_w(words, owp, lwp, rwp, ~static_cast<EData>(0), 1);
 }
 
+#ifdef VL_HAVE_INT128
+__extension__ typedef unsigned __int128 VlQ128;
+
+// Internal usage, 64-bit limb of wide data, zero padded
+static inline QData _vl_limb_q(int words, WDataInP const lwp, int limb) VL_PURE {
+    const int word = limb * 2;
+    return static_cast<QData>(lwp[word])
+           | ((word + 1 < words) ? (static_cast<QData>(lwp[word + 1]) << 32ULL) : 0);
+}
+#endif
+
 static inline WDataOutP VL_MUL_W(int words, WDataOutP owp, WDataInP const lwp,
                                  WDataInP const rwp) VL_MT_SAFE {
-    for (int i = 0; i < words; ++i) owp[i] = 0;
-    for (int lword = 0; lword < words; ++lword) {
-        for (int rword = 0; rword < words; ++rword) {
-            QData mul = static_cast<QData>(lwp[lword]) * static_cast<QData>(rwp[rword]);
-            for (int qword = lword + rword; qword < words; ++qword) {
-                mul += static_cast<QData>(owp[qword]);
-                owp[qword] = (mul & 0xffffffffULL);
-                mul = (mul >> 32ULL) & 0xffffffffULL;
-            }
+    // Column by column, summing the partial products of each output word
+    // into a three word accumulator, so carries are propagated once per column
+#ifdef VL_HAVE_INT128
+    // Using 64-bit limbs, a quarter of the 32-bit partial products
+    const int limbs = (words + 1) / 2;
+    VlQ128 acc = 0;
+    QData accHigh = 0;
+    for (int olimb = 0; olimb < limbs; ++olimb) {
+        for (int llimb = 0; llimb <= olimb; ++llimb) {
+            const VlQ128 mul = static_cast<VlQ128>(_vl_limb_q(words, lwp, llimb))
+                               * _vl_limb_q(words, rwp, olimb - llimb);
+            acc += mul;
+            accHigh += (acc < mul);
         }
+        const QData out = static_cast<QData>(acc);
+        owp[olimb * 2] = static_cast<EData>(out);
+        if (olimb * 2 + 1 < words) owp[olimb * 2 + 1] = static_cast<EData>(out >> 32ULL);
+        acc = (acc >> 64) | (static_cast<VlQ128>(accHigh) << 64);
+        accHigh = 0;
     }
+#else
+    QData acc = 0;
+    EData accHigh = 0;
+    for (int oword = 0; oword < words; ++oword) {
+        for (int lword = 0; lword <= oword; ++lword) {
+            const QData mul
+                = static_cast<QData>(lwp[lword]) * static_cast<QData>(rwp[oword - lword]);
+            acc += mul;
+            accHigh += (acc < mul);
+        }
+        owp[oword] = static_cast<EData>(acc);
+        acc = (acc >> 32ULL) | (static_cast<QData>(accHigh) << 32ULL);
+        accHigh = 0;
+    }
+#endif
     // Last output word is dirty
     return owp;
 }
@@ -1294,6 +1505,160 @@ WDataOutP VL_POWSS_WWQ(int obits, int, int rbits, WDataOutP owp, WDataInP const
 QData VL_POWSS_QQW(int obits, int, int rbits, QData lhs, WDataInP const rwp, bool lsign,
                    bool rsign) VL_MT_SAFE;
 
+//===================================================================
+// Fixed-width wide operations
+//
+// Same as the VL_*_W functions above, with the number of words as a template
+// argument. Verilated code calls these for values up to 8 words (256 bits),
+// so the loops have constant trip counts and can be unrolled even where the
+// call is not inlined.
+//
+// Where the compiler has a native 128-bit integer, values of 3 or 4 words
+// (65-128 bits) are instead loaded into one, so carries and multiplies use
+// the hardware rather than a loop over words.
+
+#ifdef VL_HAVE_INT128
+// Internal usage
+template <int N_Words>
+static inline VlQ128 _vl_load_q128(WDataInP const lwp) VL_PURE {
+    VlQ128 r = 0;
+    for (int i = N_Words - 1; i >= 0; --i) r = (r << 32) | lwp[i];
+    return r;
+}
+template <int N_Words>
+static inline WDataOutP _vl_store_q128(WDataOutP owp, VlQ128 val) VL_MT_SAFE {
+    for (int i = 0; i < N_Words; ++i) owp[i] = static_cast<EData>(val >> (32 * i));
+    return owp;
+}
+template <int N_Words>
+static inline int _vl_cmp_q128(WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    const VlQ128 lhs = _vl_load_q128<N_Words>(lwp);
+    const VlQ128 rhs = _vl_load_q128<N_Words>(rwp);
+    return (lhs > rhs) - (lhs < rhs);
+}
+#define VL_Q128_WORDS(n_words) ((n_words) >= 3 && (n_words) <= 4)
+#endif
+
+// Internal usage
+template <int N_Words>
+static inline int _vl_cmp_w(WDataInP const lwp, WDataInP const rwp) VL_PURE {
+#ifdef VL_HAVE_INT128
+    if (VL_Q128_WORDS(N_Words)) return _vl_cmp_q128<N_Words>(lwp, rwp);
+#endif
+    return _vl_cmp_w(N_Words, lwp, rwp);
+}
+
+template <int N_Words>
+static inline IData VL_REDOR_W(WDataInP const lwp) VL_PURE {
+    EData equal = 0;
+    for (int i = 0; i < N_Words; ++i) equal |= lwp[i];
+    return (equal != 0);
+}
+template <int N_Words>
+static inline IData VL_REDXOR_W(WDataInP const lwp) VL_PURE {
+    EData r = lwp[0];
+    for (int i = 1; i < N_Words; ++i) r ^= lwp[i];
+    return VL_REDXOR_32(r);
+}
+
+template <int N_Words>
+static inline WDataOutP VL_AND_W(WDataOutP owp, WDataInP const lwp,
+                                 WDataInP const rwp) VL_MT_SAFE {
+    for (int i = 0; i < N_Words; ++i) owp[i] = (lwp[i] & rwp[i]);
+    return owp;
+}
+template <int N_Words>
+static inline WDataOutP VL_OR_W(WDataOutP owp, WDataInP const lwp, WDataInP const rwp) VL_MT_SAFE {
+    for (int i = 0; i < N_Words; ++i) owp[i] = (lwp[i] | rwp[i]);
+    return owp;
+}
+template <int N_Words>
+static inline WDataOutP VL_XOR_W(WDataOutP owp, WDataInP const lwp,
+                                 WDataInP const rwp) VL_MT_SAFE {
+    for (int i = 0; i < N_Words; ++i) owp[i] = (lwp[i] ^ rwp[i]);
+    return owp;
+}
+template <int N_Words>
+static inline WDataOutP VL_NOT_W(WDataOutP owp, WDataInP const lwp) VL_MT_SAFE {
+    for (int i = 0; i < N_Words; ++i) owp[i] = ~(lwp[i]);
+    return owp;
+}
+
+template <int N_Words>
+static inline IData VL_EQ_W(WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    EData nequal = 0;
+    for (int i = 0; i < N_Words; ++i) nequal |= (lwp[i] ^ rwp[i]);
+    return (nequal == 0);
+}
+template <int N_Words>
+static inline IData VL_NEQ_W(WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return !VL_EQ_W<N_Words>(lwp, rwp);
+}
+template <int N_Words>
+static inline IData VL_LT_W(WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return _vl_cmp_w<N_Words>(lwp, rwp) < 0;
+}
+template <int N_Words>
+static inline IData VL_LTE_W(WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return _vl_cmp_w<N_Words>(lwp, rwp) <= 0;
+}
+template <int N_Words>
+static inline IData VL_GT_W(WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return _vl_cmp_w<N_Words>(lwp, rwp) > 0;
+}
+template <int N_Words>
+static inline IData VL_GTE_W(WDataInP const lwp, WDataInP const rwp) VL_PURE {
+    return _vl_cmp_w<N_Words>(lwp, rwp) >= 0;
+}
+
+template <int N_Words>
+static inline WDataOutP VL_ADD_W(WDataOutP owp, WDataInP const lwp,
+                                 WDataInP const rwp) VL_MT_SAFE {
+#ifdef VL_HAVE_INT128
+    if (VL_Q128_WORDS(N_Words)) {
+        return _vl_store_q128<N_Words>(
+            owp, _vl_load_q128<N_Words>(lwp) + _vl_load_q128<N_Words>(rwp));
+    }
+#endif
+    return _vl_add_w(N_Words, owp, lwp, rwp, 0, 0);
+}
+template <int N_Words>
+static inline WDataOutP VL_SUB_W(WDataOutP owp, WDataInP const lwp,
+                                 WDataInP const rwp) VL_MT_SAFE {
+#ifdef VL_HAVE_INT128
+    if (VL_Q128_WORDS(N_Words)) {
+        return _vl_store_q128<N_Words>(
+            owp, _vl_load_q128<N_Words>(lwp) - _vl_load_q128<N_Words>(rwp));
+    }
+#endif
+    return _vl_add_w(N_Words, owp, lwp, rwp, ~static_cast<EData>(0), 1);
+}
+template <int N_Words>
+static inline WDataOutP VL_NEGATE_W(WDataOutP owp, WDataInP const lwp) VL_MT_SAFE {
+#ifdef VL_HAVE_INT128
+    if (VL_Q128_WORDS(N_Words)) {
+        return _vl_store_q128<N_Words>(owp, -_vl_load_q128<N_Words>(lwp));
+    }
+#endif
+    EData carry = 1;
+    for (int i = 0; i < N_Words; ++i) {
+        owp[i] = ~lwp[i] + carry;
+        carry = (owp[i] < ~lwp[i]);
+    }
+    return owp;
+}
+template <int N_Words>
+static inline WDataOutP VL_MUL_W(WDataOutP owp, WDataInP const lwp,
+                                 WDataInP const rwp) VL_MT_SAFE {
+#ifdef VL_HAVE_INT128
+    if (VL_Q128_WORDS(N_Words)) {
+        return _vl_store_q128<N_Words>(
+            owp, _vl_load_q128<N_Words>(lwp) * _vl_load_q128<N_Words>(rwp));
+    }
+#endif
+    return VL_MUL_W(N_Words, owp, lwp, rwp);
+}
+
 //===================================================================
 // Concat/replication
 
@@ -1931,8 +2296,13 @@ static inline WDataOutP VL_SHIFTL_WWI(int obits, int, int, WDataOutP owp, WDataI
         for (int i = 0; i < word_shift; ++i) owp[i] = 0;
         for (int i = word_shift; i < VL_WORDS_I(obits); ++i) owp[i] = lwp[i - word_shift];
     } else {
-        for (int i = 0; i < VL_WORDS_I(obits); ++i) owp[i] = 0;
-        _vl_insert_WW(owp, lwp, obits - 1, rd);
+        // Each output word above the lowest takes bits from two input words
+        const int owords = VL_WORDS_I(obits);
+        for (int i = 0; i < word_shift; ++i) owp[i] = 0;
+        owp[word_shift] = lwp[0] << bit_shift;
+        _vl_shiftr_pairs_w(owords - word_shift - 1, owp + word_shift + 1, lwp,
+                           VL_EDATASIZE - bit_shift);
+        owp[owords - 1] &= VL_MASK_E(obits);
     }
     return owp;
 }
@@ -2002,14 +2372,11 @@ static inline WDataOutP VL_SHIFTR_WWI(int obits, int, int, WDataOutP owp, WDataI
         for (int i = copy_words; i < VL_WORDS_I(obits); ++i) owp[i] = 0;
     } else {
         const int loffset = rd & VL_SIZEBITS_E;
-        const int nbitsonright = VL_EDATASIZE - loffset;  // bits that end up in lword (know
-                                                          // loffset!=0) Middle words
+        // Middle words, all but the top one with an upper input word
         const int words = VL_WORDS_I(obits - rd);
-        for (int i = 0; i < words; ++i) {
-            owp[i] = lwp[i + word_shift] >> loffset;
-            const int upperword = i + word_shift + 1;
-            if (upperword < VL_WORDS_I(obits)) owp[i] |= lwp[upperword] << nbitsonright;
-        }
+        const int pairs = std::min(words, VL_WORDS_I(obits) - word_shift - 1);
+        _vl_shiftr_pairs_w(pairs, owp, lwp + word_shift, loffset);
+        for (int i = pairs; i < words; ++i) owp[i] = lwp[i + word_shift] >> loffset;
         for (int i = words; i < VL_WORDS_I(obits); ++i) owp[i] = 0;
     }
     return owp;
@@ -2082,15 +2449,11 @@ static inline WDataOutP VL_SHIFTRS_WWI(int obits, int lbits, int, WDataOutP owp,
         owp[lmsw] &= VL_MASK_E(lbits);
     } else {
         const int loffset = rd & VL_SIZEBITS_E;
-        const int nbitsonright
-            = VL_EDATASIZE - loffset;  // bits that end up in lword (know loffset!=0)
-        // Middle words
+        // Middle words, all but the top one with an upper input word
         const int words = VL_WORDS_I(obits - rd);
-        for (int i = 0; i < words; ++i) {
-            owp[i] = lwp[i + word_shift] >> loffset;
-            const int upperword = i + word_shift + 1;
-            if (upperword < VL_WORDS_I(obits)) owp[i] |= lwp[upperword] << nbitsonright;
-        }
+        const int pairs = std::min(words, VL_WORDS_I(obits) - word_shift - 1);
+        _vl_shiftr_pairs_w(pairs, owp, lwp + word_shift, loffset);
+        for (int i = pairs; i < words; ++i) owp[i] = lwp[i + word_shift] >> loffset;
         if (words) owp[words - 1] |= sign & ~VL_MASK_E(obits - loffset);
         for (int i = words; i < VL_WORDS_I(obits); ++i) owp[i] = sign;
         owp[lmsw] &= VL_MASK_E(lbits);
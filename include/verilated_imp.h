@@ -39,6 +39,7 @@
 #include <numeric>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 #include <functional>
@@ -205,8 +206,12 @@ class VerilatedContextImpData final {
 protected:
     // Map of <scope_name, scope pointer>
     // Used by scopeInsert, scopeFind, scopeErase, scopeNameMap
-    mutable VerilatedMutex m_nameMutex;  // Protect m_nameMap
+    mutable VerilatedMutex m_nameMutex;  // Protect m_nameMap, m_nameHash
     VerilatedScopeNameMap m_nameMap VL_GUARDED_BY(m_nameMutex);
+    // Hashed index of m_nameMap, so scopeFind is O(1) on designs with many scopes;
+    // m_nameMap is kept for sorted iteration by scopeNameMap users
+    std::unordered_map<const char*, const VerilatedScope*, VerilatedCStrHash, VerilatedCStrEq>
+        m_nameHash VL_GUARDED_BY(m_nameMutex);
 };
 
 //======================================================================
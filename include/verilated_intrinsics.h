@@ -38,6 +38,9 @@
 #  define VL_HAVE_AVX2 1
 #  include <immintrin.h>
 # endif
+# if defined(__SIZEOF_INT128__) && !defined(VL_DISABLE_INT128)
+#  define VL_HAVE_INT128 1
+# endif
 #endif
 
 // clang-format on
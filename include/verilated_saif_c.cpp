@@ -59,76 +59,6 @@
 #undef VL_SUB_T
 #undef VL_BUF_T
 
-//=============================================================================
-// VerilatedSaifActivityBit
-
-class VerilatedSaifActivityBit final {
-    // MEMBERS
-    bool m_lastVal = false;  // Last emitted activity bit value
-    uint64_t m_highTime = 0;  // Total time when bit was high
-    size_t m_transitions = 0;  // Total number of bit transitions
-
-public:
-    // METHODS
-    VL_ATTR_ALWINLINE
-    void aggregateVal(uint64_t dt, bool newVal) {
-        m_transitions += newVal != m_lastVal ? 1 : 0;
-        m_highTime += m_lastVal ? dt : 0;
-        m_lastVal = newVal;
-    }
-
-    // ACCESSORS
-    VL_ATTR_ALWINLINE bool bitValue() const { return m_lastVal; }
-    VL_ATTR_ALWINLINE uint64_t highTime() const { return m_highTime; }
-    VL_ATTR_ALWINLINE uint64_t toggleCount() const { return m_transitions; }
-};
-
-//=============================================================================
-// VerilatedSaifActivityVar
-
-class VerilatedSaifActivityVar final {
-    // MEMBERS
-    uint64_t m_lastTime = 0;  // Last time when variable value was updated
-    VerilatedSaifActivityBit* m_bits;  // Pointer to variable bits objects
-    uint32_t m_width;  // Width of variable (in bits)
-
-public:
-    // CONSTRUCTORS
-    VerilatedSaifActivityVar(uint32_t width, VerilatedSaifActivityBit* bits)
-        : m_bits{bits}
-        , m_width{width} {}
-
-    VerilatedSaifActivityVar(VerilatedSaifActivityVar&&) = default;
-    VerilatedSaifActivityVar& operator=(VerilatedSaifActivityVar&&) = default;
-
-    // METHODS
-    VL_ATTR_ALWINLINE void emitBit(uint64_t time, CData newval);
-
-    template <typename DataType>
-    VL_ATTR_ALWINLINE void emitData(uint64_t time, DataType newval, uint32_t bits) {
-        static_assert(std::is_integral<DataType>::value,
-                      "The emitted value must be of integral type");
-
-        const uint64_t dt = time - m_lastTime;
-        for (size_t i = 0; i < std::min(m_width, bits); ++i) {
-            m_bits[i].aggregateVal(dt, (newval >> i) & 1);
-        }
-        updateLastTime(time);
-    }
-
-    VL_ATTR_ALWINLINE void emitWData(uint64_t time, const WData* newvalp, uint32_t bits);
-    VL_ATTR_ALWINLINE void updateLastTime(uint64_t val) { m_lastTime = val; }
-
-    // ACCESSORS
-    VL_ATTR_ALWINLINE uint32_t width() const { return m_width; }
-    VL_ATTR_ALWINLINE VerilatedSaifActivityBit& bit(std::size_t index);
-    VL_ATTR_ALWINLINE uint64_t lastUpdateTime() const { return m_lastTime; }
-
-private:
-    // CONSTRUCTORS
-    VL_UNCOPYABLE(VerilatedSaifActivityVar);
-};
-
 //=============================================================================
 // VerilatedSaifActivityScope
 
@@ -195,15 +125,19 @@ class VerilatedSaifActivityAccumulator final {
     // Map of scopes paths to codes of activities inside
     std::unordered_map<std::string, std::vector<std::pair<uint32_t, std::string>>>
         m_scopeToActivities;
-    // Map of variables codes mapped to their activity objects
-    std::unordered_map<uint32_t, VerilatedSaifActivityVar> m_activity;
-    // Memory pool for signals bits objects
-    std::vector<std::vector<VerilatedSaifActivityBit>> m_activityArena;
+    // Activity of variables, indexed by code
+    std::vector<VerilatedSaifActivityVar> m_activity;
+    // Toggle counters of all variables bits, consecutive for each variable
+    std::vector<VerilatedSaifActivityBit> m_bits;
 
 public:
     // METHODS
     void declare(uint32_t code, const std::string& absoluteScopePath, std::string variableName,
                  int bits, bool array, int arraynum);
+    // Make the activity of all codes indexable, once all are declared
+    void resize(uint32_t codes) {
+        if (m_activity.size() < codes) m_activity.resize(codes);
+    }
 
     // CONSTRUCTORS
     VerilatedSaifActivityAccumulator() = default;
@@ -215,36 +149,6 @@ private:
     VL_UNCOPYABLE(VerilatedSaifActivityAccumulator);
 };
 
-//=============================================================================
-//=============================================================================
-//=============================================================================
-// VerilatedSaifActivityVar implementation
-
-VL_ATTR_ALWINLINE
-void VerilatedSaifActivityVar::emitBit(const uint64_t time, const CData newval) {
-    assert(m_lastTime <= time);
-    m_bits[0].aggregateVal(time - m_lastTime, newval);
-    updateLastTime(time);
-}
-
-VL_ATTR_ALWINLINE
-void VerilatedSaifActivityVar::emitWData(const uint64_t time, const WData* newvalp,
-                                         const uint32_t bits) {
-    assert(m_lastTime <= time);
-    const uint64_t dt = time - m_lastTime;
-    for (std::size_t i = 0; i < std::min(m_width, bits); ++i) {
-        const size_t wordIndex = i / VL_EDATASIZE;
-        m_bits[i].aggregateVal(dt, (newvalp[wordIndex] >> VL_BITBIT_E(i)) & 1);
-    }
-
-    updateLastTime(time);
-}
-
-VerilatedSaifActivityBit& VerilatedSaifActivityVar::bit(const std::size_t index) {
-    assert(index < m_width);
-    return m_bits[index];
-}
-
 //=============================================================================
 //=============================================================================
 //=============================================================================
@@ -253,23 +157,23 @@ VerilatedSaifActivityBit& VerilatedSaifActivityVar::bit(const std::size_t index)
 void VerilatedSaifActivityAccumulator::declare(uint32_t code, const std::string& absoluteScopePath,
                                                std::string variableName, int bits, bool array,
                                                int arraynum) {
-    const size_t block_size = 1024;
-    if (m_activityArena.empty()
-        || m_activityArena.back().size() + bits > m_activityArena.back().capacity()) {
-        m_activityArena.emplace_back();
-        m_activityArena.back().reserve(block_size);
-    }
-    const size_t bitsIdx = m_activityArena.back().size();
-    m_activityArena.back().resize(m_activityArena.back().size() + bits);
-
     if (array) {
         variableName += '[';
         variableName += std::to_string(arraynum);
         variableName += ']';
     }
     m_scopeToActivities[absoluteScopePath].emplace_back(code, variableName);
-    m_activity.emplace(code, VerilatedSaifActivityVar{static_cast<uint32_t>(bits),
-                                                      m_activityArena.back().data() + bitsIdx});
+
+    const int words = VL_WORDS_I(bits);
+    if (m_activity.size() < code + words) m_activity.resize(code + words);
+    if (m_activity[code].width()) return;  // Alias of an already declared variable
+    // Each word's code refers to its own bits, so toggles need no per-variable lookup
+    for (int i = 0; i < words; ++i) {
+        m_activity[code + i] = VerilatedSaifActivityVar{
+            static_cast<uint32_t>(bits - i * VL_EDATASIZE),
+            static_cast<uint32_t>(m_bits.size() + i * VL_EDATASIZE)};
+    }
+    m_bits.resize(m_bits.size() + bits);
 }
 
 //=============================================================================
@@ -293,6 +197,11 @@ void VerilatedSaif::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
     initializeSaifFileContents();
 
     Super::traceInit();
+
+    // The generated code accumulates activity against the previous values,
+    // so count from all bits zero, also when reopened
+    std::fill(m_sigs_oldvalp, m_sigs_oldvalp + nextCode(), 0);
+    for (auto& accumulator : m_activityAccumulators) accumulator->resize(nextCode());
 }
 
 void VerilatedSaif::initializeSaifFileContents() {
@@ -376,9 +285,8 @@ bool VerilatedSaif::printScopeActivitiesFromAccumulatorIfPresent(
     if (accumulator.m_scopeToActivities.count(absoluteScopePath) == 0) return false;
 
     for (const auto& childSignal : accumulator.m_scopeToActivities.at(absoluteScopePath)) {
-        VerilatedSaifActivityVar& activityVariable = accumulator.m_activity.at(childSignal.first);
-        anyNetWritten
-            = printActivityStats(activityVariable, childSignal.second.c_str(), anyNetWritten);
+        anyNetWritten = printActivityStats(accumulator, childSignal.first,
+                                           childSignal.second.c_str(), anyNetWritten);
     }
 
     return anyNetWritten;
@@ -396,12 +304,14 @@ void VerilatedSaif::closeNetScope() {
     printStr(")\n");  // NET
 }
 
-bool VerilatedSaif::printActivityStats(VerilatedSaifActivityVar& activity,
-                                       const std::string& activityName, bool anyNetWritten) {
+bool VerilatedSaif::printActivityStats(const VerilatedSaifActivityAccumulator& accumulator,
+                                       uint32_t code, const std::string& activityName,
+                                       bool anyNetWritten) {
+    const VerilatedSaifActivityVar& activity = accumulator.m_activity[code];
     for (size_t i = 0; i < activity.width(); ++i) {
-        VerilatedSaifActivityBit& bit = activity.bit(i);
-
-        bit.aggregateVal(currentTime() - activity.lastUpdateTime(), bit.bitValue());
+        const VerilatedSaifActivityBit& bit = accumulator.m_bits[activity.bitsIndex() + i];
+        const bool value = VL_BITISSET_E(m_sigs_oldvalp[code + VL_BITWORD_E(i)], i);
+        const uint64_t highTime = bit.highTime(currentTime(), value);
 
         if (!anyNetWritten) {
             openNetScope();
@@ -419,16 +329,14 @@ bool VerilatedSaif::printActivityStats(VerilatedSaifActivityVar& activity,
 
         // We only have two-value logic so TZ, TX and TB will always be 0
         printStr(" (T0 ");
-        printStr(std::to_string(currentTime() - bit.highTime()));
+        printStr(std::to_string(currentTime() - highTime));
         printStr(") (T1 ");
-        printStr(std::to_string(bit.highTime()));
+        printStr(std::to_string(highTime));
         printStr(") (TZ 0) (TX 0) (TB 0) (TC ");
         printStr(std::to_string(bit.toggleCount()));
         printStr("))\n");
     }
 
-    activity.updateLastTime(currentTime());
-
     return anyNetWritten;
 }
 
@@ -597,12 +505,21 @@ void VerilatedSaif::commitTraceBuffer(VerilatedSaif::Buffer* bufp) { delete bufp
 //=============================================================================
 // VerilatedSaifBuffer implementation
 
+VerilatedSaifBuffer::VerilatedSaifBuffer(VerilatedSaif& owner)
+    : VerilatedSaifBuffer{owner, 0} {}
+
+VerilatedSaifBuffer::VerilatedSaifBuffer(VerilatedSaif& owner, uint32_t fidx)
+    : m_owner{owner}
+    , m_activityp{owner.m_activityAccumulators[fidx]->m_activity.data()}
+    , m_bitsp{owner.m_activityAccumulators[fidx]->m_bits.data()} {}
+
 //=============================================================================
 // emit* trace routines
 
 // Note: emit* are only ever called from one place (full* in
 // verilated_trace_imp.h, which is included in this file at the top),
-// so always inline them.
+// so always inline them. The generated code accumulates SAIF activity
+// with the tog* methods instead of full*, so these have nothing to do.
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitEvent(const uint32_t code) {
@@ -611,56 +528,32 @@ void VerilatedSaifBuffer::emitEvent(const uint32_t code) {
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitBit(const uint32_t code, const CData newval) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
-    activity.emitBit(m_owner.currentTime(), newval);
+    // NOP
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitCData(const uint32_t code, const CData newval, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
-    activity.emitData<CData>(m_owner.currentTime(), newval, bits);
+    // NOP
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitSData(const uint32_t code, const SData newval, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
-    activity.emitData<SData>(m_owner.currentTime(), newval, bits);
+    // NOP
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitIData(const uint32_t code, const IData newval, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
-    activity.emitData<IData>(m_owner.currentTime(), newval, bits);
+    // NOP
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitQData(const uint32_t code, const QData newval, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
-    activity.emitData<QData>(m_owner.currentTime(), newval, bits);
+    // NOP
 }
 
 VL_ATTR_ALWINLINE
 void VerilatedSaifBuffer::emitWData(const uint32_t code, const WData* newvalp, const int bits) {
-    assert(m_owner.m_activityAccumulators.at(m_fidx)->m_activity.count(code)
-           && "Activity must be declared earlier");
-    VerilatedSaifActivityVar& activity
-        = m_owner.m_activityAccumulators.at(m_fidx)->m_activity.at(code);
-    activity.emitWData(m_owner.currentTime(), newvalp, bits);
+    // NOP
 }
 
 VL_ATTR_ALWINLINE
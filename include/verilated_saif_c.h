@@ -31,8 +31,60 @@
 class VerilatedSaifBuffer;
 class VerilatedSaifActivityAccumulator;
 class VerilatedSaifActivityScope;
-class VerilatedSaifActivityVar;
-class VerilatedSaifActivityBit;
+
+//=============================================================================
+// VerilatedSaifActivityBit
+
+class VerilatedSaifActivityBit final {
+    // MEMBERS
+    // Total time when bit was high, less the time of the last rise if currently high
+    uint64_t m_highTime = 0;
+    size_t m_transitions = 0;  // Total number of bit transitions
+
+public:
+    // METHODS
+    // Record a transition at the given time, to the given new value
+    VL_ATTR_ALWINLINE
+    void toggle(uint64_t time, bool newVal) {
+        ++m_transitions;
+        // Rather than accumulating the time since the last change on every
+        // value, subtract the time of rising, and add the time of falling
+        if (newVal) {
+            m_highTime -= time;
+        } else {
+            m_highTime += time;
+        }
+    }
+
+    // ACCESSORS
+    // Total time when bit was high, up to the given time, with the given current value
+    VL_ATTR_ALWINLINE uint64_t highTime(uint64_t time, bool val) const {
+        return val ? m_highTime + time : m_highTime;
+    }
+    VL_ATTR_ALWINLINE uint64_t toggleCount() const { return m_transitions; }
+};
+
+//=============================================================================
+// VerilatedSaifActivityVar
+// Activity of the bits traced at one code, so there is one per word of a
+// variable, and the ones of the later words refer to the later bits
+
+class VerilatedSaifActivityVar final {
+    // MEMBERS
+    uint32_t m_width = 0;  // Width of variable from this word on (in bits), 0 if not declared
+    uint32_t m_bitsIndex = 0;  // Index of first bit in the accumulator's m_bits
+
+public:
+    // CONSTRUCTORS
+    VerilatedSaifActivityVar() = default;
+    VerilatedSaifActivityVar(uint32_t width, uint32_t bitsIndex)
+        : m_width{width}
+        , m_bitsIndex{bitsIndex} {}
+
+    // ACCESSORS
+    VL_ATTR_ALWINLINE uint32_t width() const { return m_width; }
+    VL_ATTR_ALWINLINE uint32_t bitsIndex() const { return m_bitsIndex; }
+};
 
 //=============================================================================
 // VerilatedSaif
@@ -85,8 +137,8 @@ private:
                                                  bool anyNetWritten);
     void openNetScope();
     void closeNetScope();
-    bool printActivityStats(VerilatedSaifActivityVar& activity, const std::string& activityName,
-                            bool anyNetWritten);
+    bool printActivityStats(const VerilatedSaifActivityAccumulator& accumulator, uint32_t code,
+                            const std::string& activityName, bool anyNetWritten);
 
     void incrementIndent();
     void decrementIndent();
@@ -180,6 +232,20 @@ template <>
 void VerilatedSaif::Super::set_time_resolution(const std::string& unit);
 template <>
 void VerilatedSaif::Super::dumpvars(int level, const std::string& hier);
+template <>
+void VerilatedSaif::Super::dumpScope(const std::string& glob, bool include);
+template <>
+void VerilatedSaif::Super::dumpWindow(uint64_t start, uint64_t end);
+template <>
+void VerilatedSaif::Super::dumpTrigger(const std::string& signal);
+template <>
+void VerilatedSaif::Super::dumpOn(bool flag);
+template <>
+void VerilatedSaif::Super::dumpRecorder(uint64_t dumps);
+template <>
+void VerilatedSaif::Super::dumpRecorderWrite();
+template <>
+void VerilatedSaif::Super::dumpProfile(const std::string& filename);
 #endif  // DOXYGEN
 
 //=============================================================================
@@ -193,19 +259,32 @@ class VerilatedSaifBuffer VL_NOT_FINAL {
     friend VerilatedSaif::OffloadBuffer;
 
     VerilatedSaif& m_owner;  // Trace file owning this buffer. Required by subclasses.
-    uint32_t m_fidx;  // Index of target activity accumulator
+    const VerilatedSaifActivityVar* const m_activityp;  // Activity of each code
+    VerilatedSaifActivityBit* const m_bitsp;  // Toggle counters of all variables bits
 
     // CONSTRUCTORS
-    explicit VerilatedSaifBuffer(VerilatedSaif& owner)
-        : m_owner{owner}
-        , m_fidx{0} {}
-    explicit VerilatedSaifBuffer(VerilatedSaif& owner, uint32_t fidx)
-        : m_owner{owner}
-        , m_fidx{fidx} {}
+    explicit VerilatedSaifBuffer(VerilatedSaif& owner);
+    explicit VerilatedSaifBuffer(VerilatedSaif& owner, uint32_t fidx);
     virtual ~VerilatedSaifBuffer() = default;
 
     //=========================================================================
     // Implementation of VerilatedTraceBuffer interface
+
+    // Called from the tog* methods, which the generated code calls, with the
+    // bits of the word at the given code that toggled
+    VL_ATTR_ALWINLINE void toggleWord(uint32_t code, EData changed, EData newval) {
+        const VerilatedSaifActivityVar& activity = m_activityp[code];
+        if (VL_UNLIKELY(!activity.width())) return;  // Not traced
+        VerilatedSaifActivityBit* const bitsp = m_bitsp + activity.bitsIndex();
+        const uint64_t time = m_owner.currentTime();
+        // Only visit the bits that toggled
+        do {
+            const EData lowest = changed & (~changed + 1);
+            changed ^= lowest;
+            bitsp[VL_COUNTONES_E(lowest - 1)].toggle(time, newval & lowest);
+        } while (changed);
+    }
+
     // Implementations of duck-typed methods for VerilatedTraceBuffer. These are
     // called from only one place (the full* methods), so always inline them.
     VL_ATTR_ALWINLINE void emitEvent(uint32_t code);
@@ -284,6 +363,25 @@ public:
     void dumpvars(int level, const std::string& hier) VL_MT_SAFE {
         m_sptrace.dumpvars(level, hier);
     }
+    // Trace (include = true) or do not trace (include = false) the signals
+    // under scopes matching the glob (with '*' and '?'). Call before open().
+    void dumpScope(const std::string& glob, bool include) VL_MT_SAFE {
+        m_sptrace.dumpScope(glob, include);
+    }
+    // Only dump at times within [start, end]; may be called multiple times
+    void dumpWindow(uint64_t start, uint64_t end) VL_MT_SAFE { m_sptrace.dumpWindow(start, end); }
+    // Only dump when the given hierarchical signal is non-zero
+    void dumpTrigger(const std::string& signal) VL_MT_SAFE { m_sptrace.dumpTrigger(signal); }
+    // Enable (default) or disable dumps, e.g. from an external trigger
+    void dumpOn(bool flag) VL_MT_SAFE { m_sptrace.dumpOn(flag); }
+    // Keep only the last dumps in memory, and write them on an error or
+    // dumpRecorderWrite(); see VerilatedTrace::dumpRecorder
+    void dumpRecorder(uint64_t dumps) VL_MT_SAFE { m_sptrace.dumpRecorder(dumps); }
+    // Write the dumps kept by dumpRecorder() to the file
+    void dumpRecorderWrite() VL_MT_SAFE { m_sptrace.dumpRecorderWrite(); }
+    // Write a report of the trace cost of each signal and scope to the
+    // file on close; see VerilatedTrace::dumpProfile
+    void dumpProfile(const std::string& filename) VL_MT_SAFE { m_sptrace.dumpProfile(filename); }
 
     // Internal class access
     VerilatedSaif* spTrace() { return &m_sptrace; }
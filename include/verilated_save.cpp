@@ -30,7 +30,10 @@
 #include "verilated.h"
 #include "verilated_imp.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cerrno>
+#include <chrono>
 #include <fcntl.h>
 
 // clang-format off
@@ -56,6 +59,68 @@
 static const char* const VLTSAVE_HEADER_STR = "verilatorsave02\n";
 // Value of last bytes of each file (must be multiple of 8 bytes)
 static const char* const VLTSAVE_TRAILER_STR = "vltsaved";
+// Value of first bytes of each VerilatedSaveDiff file (must be multiple of 8 bytes)
+static const char* const VLTSAVE_DIFF_HEADER_STR = "verilatorsavd01\n";
+// Block index of the VerilatedSaveDiff record holding the stream size, ending the file
+static constexpr uint64_t VLTSAVE_DIFF_END = ~0ULL;
+
+//=============================================================================
+// File helpers
+
+// Write all of buffer to file, return false on error
+static bool vl_save_write(int fd, const void* datap, size_t size) VL_MT_UNSAFE_ONE {
+    const uint8_t* wp = static_cast<const uint8_t*>(datap);
+    const uint8_t* const endp = wp + size;
+    while (wp < endp) {
+        errno = 0;
+        const ssize_t got = ::write(fd, wp, endp - wp);
+        if (got > 0) {
+            wp += got;
+        } else if (VL_UNCOVERABLE(got < 0)) {
+            if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) return false;
+        }
+    }
+    return true;
+}
+
+// Read all of buffer from file, return false on error or early EOF
+static bool vl_save_read(int fd, void* datap, size_t size) VL_MT_UNSAFE_ONE {
+    uint8_t* rp = static_cast<uint8_t*>(datap);
+    uint8_t* const endp = rp + size;
+    while (rp < endp) {
+        errno = 0;
+        const ssize_t got = ::read(fd, rp, endp - rp);
+        if (got > 0) {
+            rp += got;
+        } else if (got == 0) {
+            return false;  // EOF
+        } else if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Hash of a VerilatedSaveDiff block.  64 bits, so the chance of missing a
+// changed block is negligible, yet fast enough to hash gigabytes per save.
+static uint64_t vl_save_hash(const uint8_t* datap, size_t size) VL_PURE {
+    uint64_t hash = 0x9e3779b97f4a7c15ULL ^ size;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, datap + i, sizeof(word));
+        hash ^= word * 0xff51afd7ed558ccdULL;
+        hash = ((hash << 31) | (hash >> 33)) * 0xc4ceb9fe1a85ec53ULL;
+    }
+    for (; i < size; ++i) hash = (hash ^ datap[i]) * 0x100000001b3ULL;
+    // Final avalanche
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+}
 
 //=============================================================================
 //=============================================================================
@@ -192,25 +257,15 @@ void VerilatedRestore::closeImp() VL_MT_UNSAFE_ONE {
 void VerilatedSave::flushImp() VL_MT_UNSAFE_ONE {
     m_assertOne.check();
     if (VL_UNLIKELY(!isOpen())) return;
-    const uint8_t* wp = m_bufp;
-    while (true) {
-        const ssize_t remaining = (m_cp - wp);
-        if (remaining == 0) break;
-        errno = 0;
-        const ssize_t got = ::write(m_fd, wp, remaining);
-        if (got > 0) {
-            wp += got;
-        } else if (VL_UNCOVERABLE(got < 0)) {
-            if (VL_UNCOVERABLE(errno != EAGAIN && errno != EINTR)) {
-                // LCOV_EXCL_START
-                // write failed, presume error (perhaps out of disk space)
-                const std::string msg = std::string{__FUNCTION__} + ": " + std::strerror(errno);
-                VL_FATAL_MT("", 0, "", msg.c_str());
-                close();
-                break;
-                // LCOV_EXCL_STOP
-            }
-        }
+    if (VL_UNCOVERABLE(!vl_save_write(m_fd, m_bufp, m_cp - m_bufp))) {
+        // LCOV_EXCL_START
+        // write failed, presume error (perhaps out of disk space)
+        const std::string msg = std::string{__FUNCTION__} + ": " + std::strerror(errno);
+        VL_FATAL_MT("", 0, "", msg.c_str());
+        m_cp = m_bufp;
+        close();
+        return;
+        // LCOV_EXCL_STOP
     }
     m_cp = m_bufp;  // Reset buffer
 }
@@ -250,6 +305,254 @@ void VerilatedRestore::fill() VL_MT_UNSAFE_ONE {
     }
 }
 
+//=============================================================================
+// VerilatedSaveDiff/VerilatedRestoreDiff
+//
+// A difference file is VLTSAVE_DIFF_HEADER_STR, the block size, the chain
+// ID shared by a base and its later saves, the sequence number of the save
+// in the chain (0 for the base), then for each block that changed since the
+// previous save a record of {index, size} followed by the block's data, then
+// a {VLTSAVE_DIFF_END, stream size} record and VLTSAVE_TRAILER_STR.  The stream, which is what
+// VerilatedSave would write, is the newest copy of each block.
+
+VerilatedSaveDiff::VerilatedSaveDiff() { m_blockp = new uint8_t[blockSize()]; }
+
+VerilatedSaveDiff::~VerilatedSaveDiff() {
+    closeImp();
+    VL_DO_CLEAR(delete[] m_blockp, m_blockp = nullptr);
+}
+
+void VerilatedSaveDiff::open(const char* filenamep) VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (isOpen()) return;
+    VL_DEBUG_IF(VL_DBG_MSGF("- save: opening save difference file %s\n", filenamep););
+
+    // cppcheck-suppress duplicateExpression
+    m_fd = ::open(filenamep, O_CREAT | O_WRONLY | O_TRUNC | O_LARGEFILE | O_NONBLOCK | O_CLOEXEC,
+                  0666);
+    if (VL_UNLIKELY(m_fd < 0)) {
+        // User code can check isOpen()
+        m_isOpen = false;
+        return;
+    }
+    m_isOpen = true;
+    m_filename = filenamep;
+    m_cp = m_bufp;
+    m_blockFill = 0;
+    m_blockIndex = 0;
+    assert((std::strlen(VLTSAVE_DIFF_HEADER_STR) & 7) == 0);  // Keep aligned
+    writeFile(VLTSAVE_DIFF_HEADER_STR, std::strlen(VLTSAVE_DIFF_HEADER_STR));
+    const uint64_t size = blockSize();
+    writeFile(&size, sizeof(size));
+    if (!m_chainId) {
+        // Starting a new base. The ID need only differ between chains.
+        static std::atomic<uint64_t> s_chains{0};
+        const uint64_t now = std::chrono::system_clock::now().time_since_epoch().count();
+        const uint64_t seed[3] = {now, reinterpret_cast<uintptr_t>(this), ++s_chains};
+        m_chainId = vl_save_hash(reinterpret_cast<const uint8_t*>(seed), sizeof(seed)) | 1;
+        m_seq = 0;
+    } else {
+        ++m_seq;
+    }
+    const uint64_t chain[2] = {m_chainId, m_seq};
+    writeFile(chain, sizeof(chain));
+    header();
+}
+
+void VerilatedSaveDiff::closeImp() VL_MT_UNSAFE_ONE {
+    if (!isOpen()) return;
+    trailer();
+    flushImp();
+    const uint64_t streamSize = m_blockIndex * blockSize() + m_blockFill;
+    if (m_blockFill) blockDone();
+    const uint64_t record[2] = {VLTSAVE_DIFF_END, streamSize};
+    writeFile(record, sizeof(record));
+    writeFile(VLTSAVE_TRAILER_STR, std::strlen(VLTSAVE_TRAILER_STR));
+    if (!isOpen()) return;  // Write error, already rebased so the next save is complete
+    // This save is the base for the next one
+    m_hashes.resize(m_blockIndex);
+    m_prevBlocks = m_blockIndex;
+    m_isOpen = false;
+    ::close(m_fd);  // May get error, just ignore it
+}
+
+void VerilatedSaveDiff::flushImp() VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (VL_UNLIKELY(!isOpen())) return;
+    // Cut the stream into blocks
+    const uint8_t* rp = m_bufp;
+    while (rp < m_cp) {
+        const size_t size = std::min<size_t>(m_cp - rp, blockSize() - m_blockFill);
+        std::memcpy(m_blockp + m_blockFill, rp, size);
+        m_blockFill += size;
+        rp += size;
+        if (m_blockFill == blockSize()) blockDone();
+    }
+    m_cp = m_bufp;  // Reset buffer
+}
+
+void VerilatedSaveDiff::blockDone() VL_MT_UNSAFE_ONE {
+    // Write the block if it changed since the previous save
+    const uint64_t hash = vl_save_hash(m_blockp, m_blockFill);
+    const bool changed = m_blockIndex >= m_prevBlocks || m_hashes[m_blockIndex] != hash;
+    if (m_blockIndex >= m_hashes.size()) m_hashes.resize(m_blockIndex + 1);
+    m_hashes[m_blockIndex] = hash;
+    if (changed) {
+        const uint64_t record[2] = {m_blockIndex, m_blockFill};
+        writeFile(record, sizeof(record));
+        writeFile(m_blockp, m_blockFill);
+    }
+    ++m_blockIndex;
+    m_blockFill = 0;
+}
+
+void VerilatedSaveDiff::writeFile(const void* datap, size_t size) VL_MT_UNSAFE_ONE {
+    if (VL_UNLIKELY(!isOpen())) return;
+    if (VL_UNCOVERABLE(!vl_save_write(m_fd, datap, size))) {
+        // LCOV_EXCL_START
+        // write failed, presume error (perhaps out of disk space)
+        const std::string msg = std::string{__FUNCTION__} + ": " + std::strerror(errno);
+        VL_FATAL_MT("", 0, "", msg.c_str());
+        m_isOpen = false;
+        ::close(m_fd);
+        // Next save must be complete
+        rebase();
+        // LCOV_EXCL_STOP
+    }
+}
+
+void VerilatedRestoreDiff::open(const std::vector<std::string>& filenames) VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (isOpen() || filenames.empty()) return;
+    for (const std::string& filename : filenames) {
+        VL_DEBUG_IF(VL_DBG_MSGF("- restore: opening restore file %s\n", filename.c_str()););
+        m_filename = filename;
+        if (VL_UNLIKELY(!openOne(filename.c_str()))) {
+            // User code can check isOpen()
+            for (const int fd : m_fds) ::close(fd);
+            m_fds.clear();
+            m_blocks.clear();
+            return;
+        }
+    }
+    m_isOpen = true;
+    m_cp = m_bufp;
+    m_endp = m_bufp;
+    m_streamPos = 0;
+    header();
+}
+
+bool VerilatedRestoreDiff::openOne(const char* filenamep) VL_MT_UNSAFE_ONE {
+    // Read the file's block records, later files replace earlier blocks
+    // cppcheck-suppress duplicateExpression
+    const int fd = ::open(filenamep, O_RDONLY | O_LARGEFILE | O_CLOEXEC);
+    if (VL_UNLIKELY(fd < 0)) return false;
+    m_fds.push_back(fd);
+    const auto fatal = [filenamep](const char* whatp) {
+        const std::string msg = "Can't deserialize; "s + whatp + ": " + filenamep;
+        VL_FATAL_MT(filenamep, 0, "", msg.c_str());
+        return false;
+    };
+    char header[16];
+    assert(std::strlen(VLTSAVE_DIFF_HEADER_STR) == sizeof(header));
+    if (VL_UNLIKELY(!vl_save_read(fd, header, sizeof(header))
+                    || std::memcmp(header, VLTSAVE_DIFF_HEADER_STR, sizeof(header)))) {
+        return fatal("file has wrong header signature");
+    }
+    uint64_t size = 0;
+    if (VL_UNLIKELY(!vl_save_read(fd, &size, sizeof(size))
+                    || size != VerilatedSaveDiff::blockSize())) {
+        return fatal("file has different block size");
+    }
+    uint64_t chain[2];  // Chain ID and sequence number
+    if (VL_UNLIKELY(!vl_save_read(fd, chain, sizeof(chain)))) return fatal("file is truncated");
+    if (m_fds.size() == 1) {
+        if (VL_UNLIKELY(chain[1] != 0)) return fatal("first file is not a complete save");
+        m_chainId = chain[0];
+    } else if (VL_UNLIKELY(chain[0] != m_chainId)) {
+        return fatal("file is not from the same chain of saves as the first file");
+    } else if (VL_UNLIKELY(chain[1] != m_seq + 1)) {
+        return fatal("file is out of order, or a save between is missing");
+    }
+    m_seq = chain[1];
+    uint64_t offset = sizeof(header) + sizeof(size) + sizeof(chain);
+    while (true) {
+        uint64_t record[2];
+        if (VL_UNLIKELY(!vl_save_read(fd, record, sizeof(record)))) {
+            return fatal("file is truncated");
+        }
+        offset += sizeof(record);
+        if (record[0] == VLTSAVE_DIFF_END) {
+            m_streamSize = record[1];
+            break;
+        }
+        if (VL_UNLIKELY(record[1] > VerilatedSaveDiff::blockSize())) {
+            return fatal("file is corrupt");
+        }
+        if (record[0] >= m_blocks.size()) m_blocks.resize(record[0] + 1, Block{-1, 0, 0});
+        m_blocks[record[0]] = Block{fd, offset, static_cast<size_t>(record[1])};
+        offset += record[1];
+        if (VL_UNLIKELY(::lseek(fd, offset, SEEK_SET) < 0)) return fatal("file is truncated");
+    }
+    char trailer[8];
+    assert(std::strlen(VLTSAVE_TRAILER_STR) == sizeof(trailer));
+    if (VL_UNLIKELY(!vl_save_read(fd, trailer, sizeof(trailer))
+                    || std::memcmp(trailer, VLTSAVE_TRAILER_STR, sizeof(trailer)))) {
+        return fatal("file has wrong end-of-file signature");
+    }
+    return true;
+}
+
+void VerilatedRestoreDiff::closeImp() VL_MT_UNSAFE_ONE {
+    if (!isOpen()) return;
+    trailer();
+    flushImp();
+    m_isOpen = false;
+    for (const int fd : m_fds) ::close(fd);  // May get error, just ignore it
+    m_fds.clear();
+    m_blocks.clear();
+}
+
+void VerilatedRestoreDiff::fill() VL_MT_UNSAFE_ONE {
+    m_assertOne.check();
+    if (VL_UNLIKELY(!isOpen())) return;
+    // Move remaining characters down to start of buffer.  (No memcpy, overlaps allowed)
+    uint8_t* rp = m_bufp;
+    for (const uint8_t* sp = m_cp; sp < m_endp; *rp++ = *sp++) {}  // Overlaps
+    m_endp = m_bufp + (m_endp - m_cp);
+    m_cp = m_bufp;  // Reset buffer
+    // Read into buffer starting at m_endp, from whichever file has each block
+    while (m_endp < m_bufp + bufferSize() && m_streamPos < m_streamSize) {
+        const uint64_t index = m_streamPos / VerilatedSaveDiff::blockSize();
+        const size_t within = m_streamPos % VerilatedSaveDiff::blockSize();
+        if (VL_UNLIKELY(index >= m_blocks.size() || m_blocks[index].m_fd < 0
+                        || within >= m_blocks[index].m_size)) {
+            const std::string msg
+                = "Can't deserialize; difference files are missing a block of the base: "s
+                  + filename();
+            VL_FATAL_MT(filename().c_str(), 0, "", msg.c_str());
+            break;
+        }
+        const Block& block = m_blocks[index];
+        const size_t size
+            = std::min<uint64_t>({static_cast<uint64_t>(m_bufp + bufferSize() - m_endp),
+                                  block.m_size - within, m_streamSize - m_streamPos});
+        if (VL_UNCOVERABLE(::lseek(block.m_fd, block.m_offset + within, SEEK_SET) < 0
+                           || !vl_save_read(block.m_fd, m_endp, size))) {
+            // LCOV_EXCL_START
+            const std::string msg = std::string{__FUNCTION__} + ": " + std::strerror(errno);
+            VL_FATAL_MT("", 0, "", msg.c_str());
+            break;
+            // LCOV_EXCL_STOP
+        }
+        m_endp += size;
+        m_streamPos += size;
+    }
+    // Fill buffer from here to end with NULLs so reader's don't
+    // need to check eof each character.
+    while (m_endp < m_bufp + bufferSize()) *m_endp++ = '\0';
+}
+
 //=============================================================================
 // Serialization of types
 
@@ -27,6 +27,7 @@
 #include "verilated.h"
 
 #include <string>
+#include <vector>
 
 //=============================================================================
 // VerilatedSerialize
@@ -245,6 +246,105 @@ public:
     void fill() override VL_MT_UNSAFE_ONE;
 };
 
+//=============================================================================
+// VerilatedSaveDiff
+/// Stream-like object that serializes Verilated model to a file, writing
+/// only the blocks of the serialized state that changed since the previous
+/// save made with the same object.
+///
+/// The first save (and the first after rebase()) writes every block and is
+/// the base snapshot.  Each later save writes a difference file holding
+/// only the changed blocks, so is much smaller and faster when most model
+/// state, e.g. a large memory, is unchanged.  Changed blocks are found by
+/// hashing, so the previous state need not be kept in memory.  Use
+/// VerilatedRestoreDiff with the base and all later files to restore.
+///
+/// This class is not thread safe, it must be called by a single thread
+
+class VerilatedSaveDiff final : public VerilatedSerialize {
+private:
+    int m_fd = -1;  // File descriptor we're writing to
+    uint8_t* m_blockp;  // Block being assembled from the stream
+    size_t m_blockFill = 0;  // Bytes in m_blockp
+    uint64_t m_blockIndex = 0;  // Index of block in m_blockp
+    std::vector<uint64_t> m_hashes;  // Hash of each block at the previous save
+    size_t m_prevBlocks = 0;  // Number of blocks at the previous save, 0 = no base
+    uint64_t m_chainId = 0;  // Identifies the base and its later saves, 0 = no base
+    uint64_t m_seq = 0;  // Sequence number of the save within the chain, 0 = base
+
+    void closeImp() VL_MT_UNSAFE_ONE;
+    void flushImp() VL_MT_UNSAFE_ONE;
+    void blockDone() VL_MT_UNSAFE_ONE;
+    void writeFile(const void* datap, size_t size) VL_MT_UNSAFE_ONE;
+
+public:
+    // CONSTRUCTORS
+    /// Construct new object
+    VerilatedSaveDiff();
+    /// Flush, close and destruct
+    ~VerilatedSaveDiff() override;
+    // METHODS
+    /// Size of each block compared between saves
+    static constexpr size_t blockSize() { return 64 * 1024L; }
+    /// Open the file; call isOpen() to see if errors
+    void open(const char* filenamep) VL_MT_UNSAFE_ONE;
+    /// Open the file; call isOpen() to see if errors
+    void open(const std::string& filename) VL_MT_UNSAFE_ONE { open(filename.c_str()); }
+    /// Flush and close the file
+    void close() override VL_MT_UNSAFE_ONE { closeImp(); }
+    /// Flush data to file
+    void flush() override VL_MT_UNSAFE_ONE { flushImp(); }
+    /// Forget the previous save, so the next save writes a new base snapshot
+    void rebase() VL_MT_UNSAFE_ONE {
+        m_hashes.clear();
+        m_prevBlocks = 0;
+        m_chainId = 0;
+        m_seq = 0;
+    }
+};
+
+//=============================================================================
+// VerilatedRestoreDiff
+/// Stream-like object that serializes Verilated model from a base file
+/// and difference files written by VerilatedSaveDiff.
+///
+/// This class is not thread safe, it must be called by a single thread
+
+class VerilatedRestoreDiff final : public VerilatedDeserialize {
+private:
+    struct Block final {
+        int m_fd;  // File descriptor holding the newest copy of the block
+        uint64_t m_offset;  // Offset of the block's data in the file
+        size_t m_size;  // Size of the block's data
+    };
+    std::vector<int> m_fds;  // File descriptors of all files, base first
+    std::vector<Block> m_blocks;  // Where to read each block of the stream
+    uint64_t m_streamSize = 0;  // Size of the stream in the newest file
+    uint64_t m_streamPos = 0;  // Stream position of m_endp
+    uint64_t m_chainId = 0;  // Chain ID of the base file
+    uint64_t m_seq = 0;  // Sequence number of the last file opened
+
+    void closeImp() VL_MT_UNSAFE_ONE;
+    void flushImp() VL_MT_UNSAFE_ONE {}
+    bool openOne(const char* filenamep) VL_MT_UNSAFE_ONE;
+
+public:
+    // CONSTRUCTORS
+    /// Construct new object
+    VerilatedRestoreDiff() = default;
+    /// Flush, close and destruct
+    ~VerilatedRestoreDiff() override { closeImp(); }
+
+    // METHODS
+    /// Open the base file followed by each difference file, in the order
+    /// they were saved; call isOpen() to see if errors
+    void open(const std::vector<std::string>& filenames) VL_MT_UNSAFE_ONE;
+    /// Close the files
+    void close() override VL_MT_UNSAFE_ONE { closeImp(); }
+    void flush() override VL_MT_UNSAFE_ONE { flushImp(); }
+    void fill() override VL_MT_UNSAFE_ONE;
+};
+
 //=============================================================================
 
 inline VerilatedSerialize& operator<<(VerilatedSerialize& os, const uint64_t& rhs) {
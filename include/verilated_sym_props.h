@@ -254,6 +254,7 @@ class VerilatedVar final : public VerilatedVarProps {
     const char* const m_namep;  // Name - slowpath
 protected:
     const bool m_isParam;
+    int32_t m_dirtyIndex = -1;  // Index of VPI value change flag (--vpi-dirty), -1 = none
     friend class VerilatedScope;
     // CONSTRUCTORS
     VerilatedVar(const char* namep, void* datap, VerilatedVarType vltype,
@@ -269,6 +270,7 @@ public:
     void* datap() const { return m_datap; }
     const char* name() const { return m_namep; }
     bool isParam() const { return m_isParam; }
+    int32_t dirtyIndex() const { return m_dirtyIndex; }
 };
 
 #endif  // Guard
@@ -46,6 +46,20 @@ struct VerilatedCStrCmp final {
     bool operator()(const char* a, const char* b) const { return std::strcmp(a, b) < 0; }
 };
 
+// Class to hash const char*'s by contents, for unordered maps keyed by names
+struct VerilatedCStrHash final {
+    size_t operator()(const char* a) const {
+        // FNV-1a; names are short and differ mostly in their tails
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (; *a; ++a) hash = (hash ^ static_cast<uint8_t>(*a)) * 0x100000001b3ULL;
+        return static_cast<size_t>(hash);
+    }
+};
+// Class to compare const char*'s by contents, for unordered maps keyed by names
+struct VerilatedCStrEq final {
+    bool operator()(const char* a, const char* b) const { return std::strcmp(a, b) == 0; }
+};
+
 // Map of sorted scope names to find associated scope class
 // This is a class instead of typedef/using to allow forward declaration in verilated.h
 class VerilatedScopeNameMap final
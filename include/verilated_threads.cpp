@@ -55,8 +55,7 @@ VlMTaskVertex::VlMTaskVertex(uint32_t upstreamDepCount)
 // VlWorkerThread
 
 VlWorkerThread::VlWorkerThread(VerilatedContext* contextp)
-    : m_ready_size{0}
-    , m_contextp{contextp} {
+    : m_contextp{contextp} {
 #ifdef VL_USE_PTHREADS
     // Init attributes
     pthread_attr_t attr;
@@ -29,6 +29,7 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <memory>
 #include <set>
 #include <stack>
 #include <thread>
@@ -125,6 +126,149 @@ public:
     }
 };
 
+// Queue of MTasks ready to execute, used with --threads-schedule dynamic.
+// Each MTask is pushed exactly once per evaluation, when its upstream
+// dependencies are done, so the queue is a simple array filled in order, and
+// any thread may pop the next ready MTask.
+class VlMTaskReadyQueue final {
+    // MEMBERS
+    std::unique_ptr<std::atomic<uint32_t>[]> m_slotsp;  // MTask index + 1, or 0 if not yet pushed
+    uint32_t m_capacity = 0;  // Number of slots allocated
+    uint32_t m_nMTasks = 0;  // Number of MTasks in the current evaluation
+    std::atomic<uint32_t> m_head{0};  // Next slot to pop
+    std::atomic<uint32_t> m_tail{0};  // Next slot to push
+
+    VL_UNCOPYABLE(VlMTaskReadyQueue);
+
+public:
+    // CONSTANTS
+    static constexpr uint32_t DONE = 0xffffffffU;  // Returned by pop() once all MTasks were popped
+
+    // CONSTRUCTORS
+    VlMTaskReadyQueue() = default;
+    ~VlMTaskReadyQueue() = default;
+
+    // METHODS
+    // Prepare for 'nMTasks' pushes, must be called before the worker threads are started
+    void start(uint32_t nMTasks) {
+        if (VL_UNLIKELY(nMTasks > m_capacity)) {
+            m_slotsp.reset(new std::atomic<uint32_t>[nMTasks]);
+            for (uint32_t i = 0; i < nMTasks; ++i) m_slotsp[i].store(0, std::memory_order_relaxed);
+            m_capacity = nMTasks;
+        }
+        m_nMTasks = nMTasks;
+        m_head.store(0, std::memory_order_relaxed);
+        m_tail.store(0, std::memory_order_relaxed);
+    }
+    // Make the MTask with the given index ready
+    void push(uint32_t index) {
+        const uint32_t slot = m_tail.fetch_add(1, std::memory_order_relaxed);
+        assert(slot < m_nMTasks);
+        m_slotsp[slot].store(index + 1, std::memory_order_release);
+    }
+    // Return the index of the next ready MTask, waiting if none is ready yet,
+    // or DONE if all MTasks of this evaluation have been popped
+    uint32_t pop() {
+        uint32_t head = m_head.load(std::memory_order_relaxed);
+        unsigned ct = 0;
+        while (true) {
+            if (head == m_nMTasks) return DONE;
+            if (head < m_tail.load(std::memory_order_relaxed)) {
+                if (m_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed)) break;
+                continue;
+            }
+            VL_CPU_RELAX();
+            if (VL_UNLIKELY(++ct > VL_LOCK_SPINS)) {
+                ct = 0;
+                VlMTaskVertex::yieldThread();
+            }
+            head = m_head.load(std::memory_order_relaxed);
+        }
+        // The slot is reserved, but the pushing thread might not have written it yet
+        std::atomic<uint32_t>& slot = m_slotsp[head];
+        uint32_t value;
+        while (VL_UNLIKELY(!(value = slot.load(std::memory_order_acquire)))) VL_CPU_RELAX();
+        slot.store(0, std::memory_order_relaxed);
+        return value - 1;
+    }
+};
+
+#ifdef VL_THREADS_LOCKFREE
+// Bounded lock-free queue (D. Vyukov's bounded MPMC queue). Any number of
+// threads may push and pop concurrently; each operation costs a
+// compare-exchange on the position, and an acquire/release on the cell.
+template <typename T_Elem, size_t N_Size>
+class VlLockFreeQueue final {
+    static_assert(N_Size && !(N_Size & (N_Size - 1)), "Queue size must be a power of 2");
+
+    // TYPES
+    struct Cell final {
+        // Sequence number: equal to the position when the cell is free to be
+        // pushed, and position + 1 when it holds an element to be popped
+        std::atomic<size_t> m_seq;
+        T_Elem m_elem;
+    };
+
+    // MEMBERS
+    // The cells are between the positions, to keep producers and consumers
+    // off each other's cache lines
+    std::atomic<size_t> m_pushPos{0};  // Next position to push
+    Cell m_cells[N_Size];
+    std::atomic<size_t> m_popPos{0};  // Next position to pop
+
+    VL_UNCOPYABLE(VlLockFreeQueue);
+
+public:
+    // CONSTRUCTORS
+    VlLockFreeQueue() {
+        for (size_t i = 0; i < N_Size; ++i) m_cells[i].m_seq.store(i, std::memory_order_relaxed);
+    }
+    ~VlLockFreeQueue() = default;
+
+    // METHODS
+    // Push element, returns false if the queue is full
+    bool tryPush(const T_Elem& elem) {
+        size_t pos = m_pushPos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = m_cells[pos & (N_Size - 1)];
+            const size_t seq = cell.m_seq.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (m_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.m_elem = elem;
+                    cell.m_seq.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Full
+            } else {
+                pos = m_pushPos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+    // Pop element into 'elem', returns false if the queue is empty
+    bool tryPop(T_Elem& elem) {
+        size_t pos = m_popPos.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = m_cells[pos & (N_Size - 1)];
+            const size_t seq = cell.m_seq.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (m_popPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    elem = cell.m_elem;
+                    cell.m_seq.store(pos + N_Size, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // Empty
+            } else {
+                pos = m_popPos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+};
+#endif
+
 class VlWorkerThread final {
     friend class VlThreadPool;
 
@@ -143,6 +287,15 @@ class VlWorkerThread final {
     // MEMBERS
     mutable VerilatedMutex m_mutex;
     std::condition_variable_any m_cv;
+#ifdef VL_THREADS_LOCKFREE
+    // With --threads-queue lockfree, tasks are handed off through a lock-free
+    // ring. The mutex and condition variable are only used to put the worker
+    // to sleep when it runs out of work.
+    static constexpr size_t s_readySize = 64;  // Pending tasks before addTask yields
+    VlLockFreeQueue<ExecRec, s_readySize> m_ready;
+    // Only notify the condition_variable if the worker is (about to be) waiting
+    std::atomic<bool> m_waiting{false};
+#else
     // Only notify the condition_variable if the worker is waiting
     bool m_waiting VL_GUARDED_BY(m_mutex) = false;
 
@@ -151,7 +304,8 @@ class VlWorkerThread final {
     // expensive. Revisit if we ever have longer queues...
     std::vector<ExecRec> m_ready VL_GUARDED_BY(m_mutex);
     // Store the size atomically, so we can spin wait
-    std::atomic<size_t> m_ready_size;
+    std::atomic<size_t> m_ready_size{0};
+#endif
     // Thread context
     VerilatedContext* const m_contextp;
     // Underlying thread record
@@ -173,6 +327,42 @@ public:
     ~VlWorkerThread();
 
     // METHODS
+#ifdef VL_THREADS_LOCKFREE
+    template <bool N_SpinWait>
+    void dequeWork(ExecRec* workp) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        // Spin for a while, waiting for new data
+        if VL_CONSTEXPR_CXX17 (N_SpinWait) {
+            for (unsigned i = 0; i < VL_LOCK_SPINS; ++i) {
+                if (VL_LIKELY(m_ready.tryPop(*workp))) return;
+                VL_CPU_RELAX();
+            }
+        }
+        if (m_ready.tryPop(*workp)) return;
+        VerilatedLockGuard lock{m_mutex};
+        while (true) {
+            // Announce the intent to sleep before the final check, pairs with
+            // the fence in addTask, so either we see the task, or the producer
+            // sees m_waiting and notifies us after we released the mutex.
+            m_waiting.store(true, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (m_ready.tryPop(*workp)) break;
+            m_cv.wait(m_mutex);
+        }
+        m_waiting.store(false, std::memory_order_relaxed);
+    }
+    void addTask(VlExecFnp fnp, VlSelfP selfp, bool evenCycle = false)
+        VL_MT_SAFE_EXCLUDES(m_mutex) {
+        const ExecRec rec{fnp, selfp, evenCycle};
+        while (VL_UNLIKELY(!m_ready.tryPush(rec))) std::this_thread::yield();
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (VL_UNLIKELY(m_waiting.load(std::memory_order_relaxed))) {
+            // Acquire the mutex to ensure the worker is inside 'wait', or has
+            // not yet done its final check
+            { const VerilatedLockGuard lock{m_mutex}; }
+            m_cv.notify_one();
+        }
+    }
+#else
     template <bool N_SpinWait>
     void dequeWork(ExecRec* workp) VL_MT_SAFE_EXCLUDES(m_mutex) {
         // Spin for a while, waiting for new data
@@ -205,6 +395,7 @@ public:
         }
         if (notify) m_cv.notify_one();
     }
+#endif
 
     void shutdown();  // Finish current tasks, then terminate thread
     void wait();  // Blocks calling thread until all tasks complete in this thread
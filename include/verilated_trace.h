@@ -41,6 +41,7 @@
 // clang-format on
 
 class VlThreadPool;
+class VlWorkerThread;
 template <typename T_Buffer>
 class VerilatedTraceBuffer;
 template <typename T_Buffer>
@@ -158,6 +159,7 @@ public:
         CHG_IDATA = 0x4,
         CHG_QDATA = 0x5,
         CHG_WDATA = 0x6,
+        CHG_WDATA_DELTA = 0x7,  // Runs of XOR deltas of changed words of a WData
         CHG_DOUBLE = 0x8,
         CHG_EVENT = 0x9,
         // TODO: full..
@@ -177,11 +179,15 @@ public:
     const bool m_useParallel;  // Use parallel tracing
     const bool m_useOffloading;  // Offloading trace rendering
     const bool m_useFstWriterThread;  // Use the separate FST writer thread
+    // Worker threads owned by the trace file for parallel tracing, 0 = use model's thread pool
+    const unsigned m_parallelThreads;
 
-    VerilatedTraceConfig(bool useParallel, bool useOffloading, bool useFstWriterThread)
+    VerilatedTraceConfig(bool useParallel, bool useOffloading, bool useFstWriterThread,
+                         unsigned parallelThreads = 0)
         : m_useParallel{useParallel}
         , m_useOffloading{useOffloading}
-        , m_useFstWriterThread{useFstWriterThread} {}
+        , m_useFstWriterThread{useFstWriterThread}
+        , m_parallelThreads{parallelThreads} {}
 };
 
 //=============================================================================
@@ -258,6 +264,7 @@ private:
         const dumpCb_t m_cb;  // The callback
         void* const m_userp;  // The use pointer to pass to the callback
         Buffer* const m_bufp;  // The buffer pointer to pass to the callback
+        std::vector<uint32_t> m_record;  // Flight recorder commands of this buffer
         std::atomic<bool> m_ready{false};  // The ready flag
         mutable VerilatedMutex m_mutex;  // Mutex for suspension until ready
         std::condition_variable_any m_cv;  // Condition variable for suspension
@@ -274,9 +281,15 @@ private:
     // Passed a ParallelWorkerData*, second argument is ignored
     static void parallelWorkerTask(void*, bool);
 
+    // Worker threads owned by this trace file for parallel tracing. If empty,
+    // parallel tracing uses the thread pool of the VerilatedContext instead.
+    std::vector<VlWorkerThread*> m_parallelWorkers;
+
 protected:
     uint32_t* m_sigs_oldvalp = nullptr;  // Previous value store
     EData* m_sigs_enabledp = nullptr;  // Bit vector of enabled codes (nullptr = all on)
+    // Number of enabled codes below each code (nullptr = all on)
+    uint32_t* m_sigs_enabledCountp = nullptr;
 private:
     std::vector<bool> m_sigs_enabledVec;  // Staging for m_sigs_enabledp
     std::vector<CallbackRecord> m_initCbs;  // Routines to initialize tracing
@@ -294,6 +307,25 @@ private:
     uint32_t m_maxBits = 0;  // Number of bits in the widest signal
     // TODO: Should keep this as a Trie, that is how it's accessed all the time.
     std::vector<std::pair<int, std::string>> m_dumpvars;  // dumpvar() entries
+    std::vector<std::string> m_dumpScopeIncludes;  // dumpScope() globs to trace, empty = all
+    std::vector<std::string> m_dumpScopeExcludes;  // dumpScope() globs not to trace
+    std::vector<std::pair<uint64_t, uint64_t>> m_dumpWindows;  // dumpWindow(), empty = always
+    std::string m_dumpTriggerName;  // dumpTrigger() signal name, empty = none
+    const VerilatedVar* m_dumpTriggerp = nullptr;  // dumpTrigger() signal, once found
+    std::atomic<bool> m_dumpTriggerFind{false};  // m_dumpTriggerName needs looking up
+    bool m_dumpOn = true;  // dumpOn() setting
+    bool m_dumpGated = false;  // Some dumps may be skipped, due to the above
+    // Flight recorder, which keeps the last dumps in memory as offload
+    // commands, and only writes them on an error or dumpRecorderWrite()
+    uint64_t m_recorderDumps = 0;  // Dumps per recorder segment, 0 = not recording
+    uint64_t m_recorderCount = 0;  // Number of dumps since recorder was last written
+    std::vector<uint32_t> m_recorderPrev;  // Commands of the previous segment
+    std::vector<uint32_t> m_recorderCur;  // Commands of the current segment
+    bool m_recorderWrite = false;  // Write the recorder on the next flush
+    // Profiler, which counts the changes and value bytes emitted per code
+    std::string m_profileFilename;  // dumpProfile() report file, empty = not profiling
+    uint64_t* m_profilep = nullptr;  // Changes and value bytes of each code, in pairs
+    std::vector<std::pair<std::string, uint32_t>> m_profileDecls;  // Name and bits of each code
     double m_timeRes = 1e-9;  // Time resolution (ns/ms etc)
     double m_timeUnit = 1e-0;  // Time units (ns/ms etc)
     uint64_t m_timeLastDump = 0;  // Last time we did a dump
@@ -311,6 +343,16 @@ private:
     void runCallbacks(const std::vector<CallbackRecord>& cbVec);
     void runOffloadedCallbacks(const std::vector<CallbackRecord>& cbVec);
 
+    // Move to a new time point, or record it in the flight recorder
+    void timeChange(uint64_t timeui);
+    // Start a new flight recorder segment, which begins with a full dump
+    void recorderRotate();
+    // Emit the commands of the flight recorder to the trace file, and empty it
+    void recorderWrite();
+    void recorderReplay(const std::vector<uint32_t>& cmds, Buffer*& bufp);
+    // Write the profiler report to m_profileFilename
+    void profileWrite() const;
+
     // Flush any remaining data for this file
     static void onFlush(void* selfp) VL_MT_UNSAFE_ONE;
     // Close the file on termination
@@ -330,6 +372,8 @@ protected:
     uint32_t* m_offloadBufferWritep = nullptr;
     // End of offload buffer
     uint32_t* m_offloadBufferEndp = nullptr;
+    // Last values of wide signals sent to the offload worker, indexed by code
+    uint32_t* m_offloadShadowp = nullptr;
 
 private:
     // The offload worker thread itself
@@ -347,6 +391,14 @@ private:
     // Shut down and join worker, if it's running, otherwise do nothing
     void shutdownOffloadWorker();
 
+    // Return true if the signal is in the dumpScope() selection
+    bool dumpScopeEnabled(const std::string& declName) const;
+    // Return true if the dump at the given time is not skipped due to dumpWindow(),
+    // dumpTrigger() or dumpOn()
+    bool dumpGate(uint64_t timeui);
+    void dumpTriggerFind() VL_MT_SAFE_EXCLUDES(m_mutex);
+    void dumpScopeAdd(const std::string& glob, bool include) VL_REQUIRES(m_mutex);
+
     // CONSTRUCTORS
     VL_UNCOPYABLE(VerilatedTrace);
 
@@ -418,6 +470,26 @@ public:
     // Set variables to dump, using $dumpvars format
     // If level = 0, dump everything and hier is then ignored
     void dumpvars(int level, const std::string& hier) VL_MT_SAFE;
+    // Trace (include = true) or do not trace (include = false) the signals
+    // under scopes matching the glob (with '*' and '?'). Call before open().
+    void dumpScope(const std::string& glob, bool include) VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Only dump at times within [start, end]; may be called multiple times
+    void dumpWindow(uint64_t start, uint64_t end) VL_MT_SAFE;
+    // Only dump when the given hierarchical signal is non-zero. The signal
+    // must be visible to VPI, e.g. using --public-flat-rw
+    void dumpTrigger(const std::string& signal) VL_MT_SAFE;
+    // Enable (default) or disable dumps, e.g. from an external trigger
+    void dumpOn(bool flag) VL_MT_SAFE;
+    // Flight recorder: keep only the last 'dumps' to 2 * 'dumps' dumps in
+    // memory, and write them to the file only on a $stop, $fatal or other
+    // error, or when dumpRecorderWrite() is called. 0 disables.
+    void dumpRecorder(uint64_t dumps) VL_MT_SAFE;
+    // Write the dumps in the flight recorder to the file now
+    void dumpRecorderWrite() VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Profiler: count the value changes and bytes emitted for each signal,
+    // and write a report of the hottest signals and scopes to the given
+    // file when the trace is closed. Call before open().
+    void dumpProfile(const std::string& filename) VL_MT_SAFE;
 
     // Call
     void dump(uint64_t timeui) VL_MT_SAFE_EXCLUDES(m_mutex);
@@ -455,12 +527,30 @@ protected:
     static_assert(std::is_base_of<VerilatedTrace<Trace, T_Buffer>, Trace>::value, "");
 
     friend Trace;  // Give the trace file access to the private bits
+    friend VerilatedTrace<Trace, T_Buffer>;
     friend std::default_delete<VerilatedTraceBuffer<T_Buffer>>;
 
     uint32_t* const m_sigs_oldvalp;  // Previous value store
     EData* const m_sigs_enabledp;  // Bit vector of enabled codes (nullptr = all on)
+    // Number of enabled codes below each code (nullptr = all on)
+    const uint32_t* const m_sigs_enabledCountp;
+    // Flight recorder command store, nullptr = emit directly
+    std::vector<uint32_t>* m_recordp;
+    uint64_t* const m_profilep;  // Profiler counts, nullptr = not profiling
 
     explicit VerilatedTraceBuffer(Trace& owner);
+
+    // Append a flight recorder command, in the offload command encoding
+    void record(uint32_t cmd, uint32_t code, const uint32_t* datap, int words) {
+        m_recordp->push_back(cmd);
+        m_recordp->push_back(code);
+        m_recordp->insert(m_recordp->end(), datap, datap + words);
+    }
+    // Count a value change of the given number of bytes in the profiler
+    void profile(uint32_t code, uint32_t bytes) {
+        m_profilep[2 * code] += 1;
+        m_profilep[2 * code + 1] += bytes;
+    }
     ~VerilatedTraceBuffer() override = default;
 
 public:
@@ -482,6 +572,11 @@ public:
     // duck-typed void emitDouble(uint32_t code, double newval) = 0;
 
     VL_ATTR_ALWINLINE uint32_t* oldp(uint32_t code) { return m_sigs_oldvalp + code; }
+    // Return true if any code in [begin, end) is enabled, used to skip whole
+    // trace functions of scopes that are not traced
+    VL_ATTR_ALWINLINE bool anyEnabled(uint32_t begin, uint32_t end) const {
+        return !m_sigs_enabledCountp || m_sigs_enabledCountp[end] != m_sigs_enabledCountp[begin];
+    }
 
     // Write to previous value buffer value and emit trace entry.
     void fullBit(uint32_t* oldp, CData newval);
@@ -522,7 +617,18 @@ public:
         if (VL_UNLIKELY(diff)) fullQData(oldp, newval, bits);
     }
     VL_ATTR_ALWINLINE void chgWData(uint32_t* oldp, const WData* newvalp, int bits) {
-        for (int i = 0; i < (bits + 31) / 32; ++i) {
+        int i = 0;
+#ifdef VL_SIMD_WORDS
+        for (; i + VL_SIMD_WORDS <= (bits + 31) / 32; i += VL_SIMD_WORDS) {
+            const VlSimdVec diff
+                = _vl_simd_xor(_vl_simd_load(oldp + i), _vl_simd_load(newvalp + i));
+            if (VL_UNLIKELY(!_vl_simd_is_zero(diff))) {
+                fullWData(oldp, newvalp, bits);
+                return;
+            }
+        }
+#endif
+        for (; i < (bits + 31) / 32; ++i) {
             if (VL_UNLIKELY(oldp[i] ^ newvalp[i])) {
                 fullWData(oldp, newvalp, bits);
                 return;
@@ -538,6 +644,101 @@ public:
         std::memcpy(&old, oldp, sizeof(old));
         if (VL_UNLIKELY(old != newval)) fullDouble(oldp, newval);
     }
+
+    // With SAIF, the generated code calls these for all dumps, instead of the
+    // full* and chg* methods, so activity is accumulated without emitting
+    // values. Each word that differs from the previous value calls the
+    // duck-typed void toggleWord(uint32_t code, EData changed, EData newval)
+    VL_ATTR_ALWINLINE void togBit(uint32_t* oldp, CData newval) { togWord(oldp, newval); }
+    VL_ATTR_ALWINLINE void togCData(uint32_t* oldp, CData newval, int) { togWord(oldp, newval); }
+    VL_ATTR_ALWINLINE void togSData(uint32_t* oldp, SData newval, int) { togWord(oldp, newval); }
+    VL_ATTR_ALWINLINE void togIData(uint32_t* oldp, IData newval, int) { togWord(oldp, newval); }
+    VL_ATTR_ALWINLINE void togQData(uint32_t* oldp, QData newval, int) {
+        togWord(oldp, static_cast<EData>(newval));
+        togWord(oldp + 1, static_cast<EData>(newval >> VL_EDATASIZE));
+    }
+    VL_ATTR_ALWINLINE void togWData(uint32_t* oldp, const WData* newvalp, int bits) {
+        for (int i = 0; i < VL_WORDS_I(bits); ++i) togWord(oldp + i, newvalp[i]);
+    }
+
+    // Check all elements of an unpacked array, traced at consecutive codes.
+    // Unchanged blocks of elements are skipped with a single compare, and
+    // the per element check only runs on blocks with a difference.
+    VL_ATTR_ALWINLINE void chgBitArray(uint32_t* oldp, const CData* newvalp, int elements) {
+        chgNarrowArray(oldp, newvalp, elements,
+                       [&](int i) { chgBit(oldp + i, newvalp[i]); });
+    }
+    VL_ATTR_ALWINLINE void chgCDataArray(uint32_t* oldp, const CData* newvalp, int elements,
+                                         int bits) {
+        chgNarrowArray(oldp, newvalp, elements,
+                       [&](int i) { chgCData(oldp + i, newvalp[i], bits); });
+    }
+    VL_ATTR_ALWINLINE void chgSDataArray(uint32_t* oldp, const SData* newvalp, int elements,
+                                         int bits) {
+        chgNarrowArray(oldp, newvalp, elements,
+                       [&](int i) { chgSData(oldp + i, newvalp[i], bits); });
+    }
+    VL_ATTR_ALWINLINE void chgIDataArray(uint32_t* oldp, const IData* newvalp, int elements,
+                                         int bits) {
+        chgWordArray(oldp, newvalp, elements, 1,
+                     [&](int i) { chgIData(oldp + i, newvalp[i], bits); });
+    }
+    VL_ATTR_ALWINLINE void chgQDataArray(uint32_t* oldp, const QData* newvalp, int elements,
+                                         int bits) {
+        chgWordArray(oldp, newvalp, elements, 2,
+                     [&](int i) { chgQData(oldp + 2 * i, newvalp[i], bits); });
+    }
+    template <std::size_t N_Words>
+    VL_ATTR_ALWINLINE void chgWDataArray(uint32_t* oldp, const VlWide<N_Words>* newvalp,
+                                         int elements, int bits) {
+        chgWordArray(oldp, newvalp, elements, N_Words,
+                     [&](int i) { chgWData(oldp + N_Words * i, newvalp[i], bits); });
+    }
+
+private:
+    VL_ATTR_ALWINLINE void togWord(uint32_t* oldp, EData newval) {
+        const EData changed = *oldp ^ newval;
+        if (VL_LIKELY(!changed)) return;
+        *oldp = newval;
+        const uint32_t code = oldp - m_sigs_oldvalp;
+        if (VL_UNLIKELY(m_profilep)) profile(code, sizeof(EData));
+        this->toggleWord(code, changed, newval);
+    }
+    // Elements narrower than a word are widened in the previous value
+    // buffer, so OR together the differences of a block of elements.
+    template <typename T_Elem, typename T_Chg>
+    VL_ATTR_ALWINLINE void chgNarrowArray(const uint32_t* oldp, const T_Elem* newvalp,
+                                          int elements, T_Chg chgElem) {
+        constexpr int BLOCK = 8;
+        int i = 0;
+        for (; i + BLOCK <= elements; i += BLOCK) {
+            uint32_t diff = 0;
+            for (int j = 0; j < BLOCK; ++j) diff |= oldp[i + j] ^ newvalp[i + j];
+            if (VL_LIKELY(!diff)) continue;
+            for (int j = 0; j < BLOCK; ++j) chgElem(i + j);
+        }
+        for (; i < elements; ++i) chgElem(i);
+    }
+    // Elements of 'words' words have the same layout in the previous value
+    // buffer, so compare VL_SIMD_WORDS words at a time when available.
+    template <typename T_Elem, typename T_Chg>
+    VL_ATTR_ALWINLINE void chgWordArray(const uint32_t* oldp, const T_Elem* newvalp,
+                                        int elements, int words, T_Chg chgElem) {
+        int i = 0;
+#ifdef VL_SIMD_WORDS
+        const EData* const newwp = reinterpret_cast<const EData*>(newvalp);
+        const int vecWords = (elements * words) & ~(VL_SIMD_WORDS - 1);
+        for (int w = 0; w < vecWords; w += VL_SIMD_WORDS) {
+            const VlSimdVec diff = _vl_simd_xor(_vl_simd_load(oldp + w), _vl_simd_load(newwp + w));
+            if (VL_LIKELY(_vl_simd_is_zero(diff))) continue;
+            // Elements overlapping this block, some may already have been checked
+            const int last = (w + VL_SIMD_WORDS - 1) / words;
+            for (i = std::max(i, w / words); i <= last; ++i) chgElem(i);
+        }
+        i = std::max(i, vecWords / words);
+#endif
+        for (; i < elements; ++i) chgElem(i);
+    }
 };
 
 //=============================================================================
@@ -550,9 +751,11 @@ class VerilatedTraceOffloadBuffer final : public VerilatedTraceBuffer<T_Buffer>
     using typename VerilatedTraceBuffer<T_Buffer>::Trace;
 
     friend Trace;  // Give the trace file access to the private bits
+    friend VerilatedTrace<Trace, T_Buffer>;
 
     uint32_t* m_offloadBufferWritep;  // Write pointer into current buffer
     uint32_t* const m_offloadBufferEndp;  // End of offload buffer
+    uint32_t* const m_offloadShadowp;  // Last values of wide signals sent to the worker
 
     explicit VerilatedTraceOffloadBuffer(Trace& owner);
     ~VerilatedTraceOffloadBuffer() override = default;
@@ -596,13 +799,8 @@ public:
         m_offloadBufferWritep += 4;
         VL_DEBUG_IF(assert(m_offloadBufferWritep <= m_offloadBufferEndp););
     }
-    void chgWData(uint32_t code, const WData* newvalp, int bits) {
-        m_offloadBufferWritep[0] = (bits << 4) | VerilatedTraceOffloadCommand::CHG_WDATA;
-        m_offloadBufferWritep[1] = code;
-        m_offloadBufferWritep += 2;
-        for (int i = 0; i < (bits + 31) / 32; ++i) *m_offloadBufferWritep++ = newvalp[i];
-        VL_DEBUG_IF(assert(m_offloadBufferWritep <= m_offloadBufferEndp););
-    }
+    // Wide signals only send the words that changed since the last dump
+    void chgWData(uint32_t code, const WData* newvalp, int bits);
     void chgDouble(uint32_t code, double newval) {
         m_offloadBufferWritep[0] = VerilatedTraceOffloadCommand::CHG_DOUBLE;
         m_offloadBufferWritep[1] = code;
@@ -25,9 +25,12 @@
 #endif
 
 #include "verilated_intrinsics.h"
+#include "verilated_sym_props.h"
 #include "verilated_trace.h"
 #include "verilated_threads.h"
+#include <fstream>
 #include <list>
+#include <map>
 
 #if 0
 # include <iostream>
@@ -96,12 +99,213 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::waitForOffloadBuffer(const uint32_t* bu
     }
 }
 
+//=========================================================================
+// Flight recorder
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::timeChange(uint64_t timeui) {
+    if (VL_UNLIKELY(m_recorderDumps)) {
+        m_recorderCur.push_back(VerilatedTraceOffloadCommand::TIME_CHANGE);
+        m_recorderCur.push_back(static_cast<uint32_t>(timeui >> 32ULL));
+        m_recorderCur.push_back(static_cast<uint32_t>(timeui));
+        return;
+    }
+    emitTimeChange(timeui);
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::recorderReplay(const std::vector<uint32_t>& cmds,
+                                                        Buffer*& bufp) {
+    // Commands are as recorded by the full* functions, so emit them without
+    // change detection
+    const uint32_t* readp = cmds.data();
+    const uint32_t* const endp = readp + cmds.size();
+    while (readp < endp) {
+        const uint32_t cmd = readp[0];
+        const uint32_t top = cmd >> 4;
+        const uint32_t code = readp[1];
+        switch (cmd & 0xF) {
+        case VerilatedTraceOffloadCommand::CHG_BIT_0:
+            bufp->emitBit(code, 0);
+            readp += 2;
+            continue;
+        case VerilatedTraceOffloadCommand::CHG_BIT_1:
+            bufp->emitBit(code, 1);
+            readp += 2;
+            continue;
+        case VerilatedTraceOffloadCommand::CHG_CDATA:
+            bufp->emitCData(code, readp[2], top);
+            readp += 3;
+            continue;
+        case VerilatedTraceOffloadCommand::CHG_SDATA:
+            bufp->emitSData(code, readp[2], top);
+            readp += 3;
+            continue;
+        case VerilatedTraceOffloadCommand::CHG_IDATA:
+            bufp->emitIData(code, readp[2], top);
+            readp += 3;
+            continue;
+        case VerilatedTraceOffloadCommand::CHG_QDATA: {
+            QData val;
+            std::memcpy(&val, readp + 2, sizeof(val));
+            bufp->emitQData(code, val, top);
+            readp += 4;
+            continue;
+        }
+        case VerilatedTraceOffloadCommand::CHG_WDATA:
+            bufp->emitWData(code, readp + 2, top);
+            readp += 2 + VL_WORDS_I(top);
+            continue;
+        case VerilatedTraceOffloadCommand::CHG_DOUBLE: {
+            double val;
+            std::memcpy(&val, readp + 2, sizeof(val));
+            bufp->emitDouble(code, val);
+            readp += 4;
+            continue;
+        }
+        case VerilatedTraceOffloadCommand::CHG_EVENT:
+            bufp->emitEvent(code);
+            readp += 2;
+            continue;
+        case VerilatedTraceOffloadCommand::TIME_CHANGE: {
+            const uint64_t timeui
+                = static_cast<uint64_t>(readp[1]) << 32ULL | static_cast<uint64_t>(readp[2]);
+            // Commit the previous time point before starting the next
+            if (bufp) commitTraceBuffer(bufp);
+            emitTimeChange(timeui);
+            bufp = getTraceBuffer(0);
+            readp += 3;
+            continue;
+        }
+        default: {  // LCOV_EXCL_START
+            VL_FATAL_MT(__FILE__, __LINE__, "", "Unknown trace command");
+            return;
+        }  // LCOV_EXCL_STOP
+        }
+    }
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::recorderWrite() {
+    // Oldest first, each segment starts with a time change
+    Buffer* bufp = nullptr;
+    recorderReplay(m_recorderPrev, bufp);
+    recorderReplay(m_recorderCur, bufp);
+    if (bufp) commitTraceBuffer(bufp);
+    m_recorderPrev.clear();
+    m_recorderCur.clear();
+    // The file is now up to date, the next dump starts a new segment
+    m_recorderCount = 0;
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dumpRecorder(uint64_t dumps) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_recorderDumps = dumps;
+    m_recorderCount = 0;
+    m_recorderPrev.clear();
+    m_recorderCur.clear();
+    m_fullDump = true;
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dumpRecorderWrite() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    {
+        const VerilatedLockGuard lock{m_mutex};
+        m_recorderWrite = true;
+    }
+    // This calls 'flush' on the derived class (which must then get any mutex)
+    self()->flush();
+}
+
+//=========================================================================
+// Profiler
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dumpProfile(const std::string& filename) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_profileFilename = filename;
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::profileWrite() const {
+    constexpr size_t TOP_SIGNALS = 100;  // Number of signals in the report
+    // Totals of each scope above a signal, and the whole trace
+    struct Totals final {
+        uint64_t m_changes = 0;
+        uint64_t m_bytes = 0;
+        uint32_t m_signals = 0;
+    };
+    std::map<std::string, Totals> scopes;
+    Totals all;
+    std::vector<uint32_t> codes;
+    for (uint32_t code = 1; code < m_profileDecls.size(); ++code) {
+        const std::string& name = m_profileDecls[code].first;
+        if (name.empty()) continue;  // Not the first code of a signal
+        const uint64_t changes = m_profilep[2 * code];
+        const uint64_t bytes = m_profilep[2 * code + 1];
+        codes.push_back(code);
+        all.m_changes += changes;
+        all.m_bytes += bytes;
+        ++all.m_signals;
+        for (size_t pos = name.find(' '); pos != std::string::npos;
+             pos = name.find(' ', pos + 1)) {
+            Totals& totals = scopes[name.substr(0, pos)];
+            totals.m_changes += changes;
+            totals.m_bytes += bytes;
+            ++totals.m_signals;
+        }
+    }
+    std::stable_sort(codes.begin(), codes.end(), [this](uint32_t a, uint32_t b) {
+        return m_profilep[2 * a + 1] > m_profilep[2 * b + 1];
+    });
+    if (codes.size() > TOP_SIGNALS) codes.resize(TOP_SIGNALS);
+
+    std::ofstream os{m_profileFilename};
+    if (VL_UNLIKELY(!os)) {
+        VL_PRINTF_MT("%%Warning: Cannot write trace profile '%s'\n", m_profileFilename.c_str());
+        return;
+    }
+    // Trace names use space separators, report them as Verilog names
+    const auto dotted = [](std::string name) {
+        for (char& c : name) {
+            if (c == ' ') c = '.';
+        }
+        return name;
+    };
+    const auto percent = [&all](uint64_t bytes) {
+        return all.m_bytes ? 100.0 * static_cast<double>(bytes) / all.m_bytes : 0.0;
+    };
+    char buf[100];
+    os << "// Verilator trace profile\n";
+    os << "// Signals: " << all.m_signals << "  Changes: " << all.m_changes
+       << "  Bytes: " << all.m_bytes << "\n";
+    os << "\nTop signals by bytes emitted:\n";
+    os << "         Changes            Bytes       %    Bits  Signal\n";
+    for (const uint32_t code : codes) {
+        VL_SNPRINTF(buf, sizeof(buf), "%16" PRIu64 " %16" PRIu64 " %6.2f%% %7u  ",
+                    m_profilep[2 * code], m_profilep[2 * code + 1],
+                    percent(m_profilep[2 * code + 1]), m_profileDecls[code].second);
+        os << buf << dotted(m_profileDecls[code].first) << "\n";
+    }
+    os << "\nHierarchy totals:\n";
+    os << "         Changes            Bytes       % Signals  Scope\n";
+    for (const auto& it : scopes) {
+        VL_SNPRINTF(buf, sizeof(buf), "%16" PRIu64 " %16" PRIu64 " %6.2f%% %7u  ",
+                    it.second.m_changes, it.second.m_bytes, percent(it.second.m_bytes),
+                    it.second.m_signals);
+        os << buf << dotted(it.first) << "\n";
+    }
+}
+
 //=========================================================================
 // Worker thread
 
 template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::offloadWorkerThreadMain() {
     bool shutdown = false;
+    // Wide values rebuilt from CHG_WDATA_DELTA commands
+    std::vector<uint32_t> wideValue(VL_WORDS_I(maxBits()));
 
     do {
         uint32_t* const bufferp = m_offloadBuffersToWorker.get();
@@ -162,6 +366,22 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::offloadWorkerThreadMain() {
                 traceBufp->chgWData(oldp, readp, top);
                 readp += VL_WORDS_I(top);
                 continue;
+            case VerilatedTraceOffloadCommand::CHG_WDATA_DELTA: {
+                VL_TRACE_OFFLOAD_DEBUG("Command CHG_WDATA_DELTA " << top);
+                // The deltas are against the previous value, which is what we
+                // hold in the previous value buffer
+                uint32_t* const newvalp = wideValue.data();
+                std::memcpy(newvalp, oldp, VL_WORDS_I(top) * sizeof(uint32_t));
+                uint32_t nRuns = *readp++;
+                uint32_t* wordp = newvalp;
+                while (nRuns--) {
+                    const uint32_t header = *readp++;
+                    wordp += header >> 16;  // Unchanged words before this run
+                    for (uint32_t i = 0; i < (header & 0xffff); ++i) *wordp++ ^= *readp++;
+                }
+                traceBufp->chgWData(oldp, newvalp, top);
+                continue;
+            }
             case VerilatedTraceOffloadCommand::CHG_DOUBLE:
                 VL_TRACE_OFFLOAD_DEBUG("Command CHG_DOUBLE " << top);
                 traceBufp->chgDouble(oldp, *reinterpret_cast<const double*>(readp));
@@ -180,7 +400,7 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::offloadWorkerThreadMain() {
                 const uint64_t timeui
                     = static_cast<uint64_t>(*reinterpret_cast<const uint32_t*>(readp)) << 32ULL
                       | static_cast<uint64_t>(*reinterpret_cast<const uint32_t*>(readp + 1));
-                emitTimeChange(timeui);
+                timeChange(timeui);
                 readp += 2;
                 continue;
             }
@@ -250,6 +470,7 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::closeBase() {
             --m_numOffloadBuffers;
         }
     }
+    if (m_profilep) profileWrite();
 }
 
 template <>
@@ -263,6 +484,12 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::flushBase() {
         // this ensures all previous buffers have been processed.
         waitForOffloadBuffer(bufferp);
     }
+    // Write the flight recorder on request, or once the simulation has failed
+    if (VL_UNLIKELY(m_recorderDumps)
+        && (m_recorderWrite || (m_contextp && m_contextp->gotError()))) {
+        m_recorderWrite = false;
+        recorderWrite();
+    }
 }
 
 //=============================================================================
@@ -292,10 +519,16 @@ VerilatedTrace<VL_SUB_T, VL_BUF_T>::VerilatedTrace() {
 template <>
 VerilatedTrace<VL_SUB_T, VL_BUF_T>::~VerilatedTrace() {
     if (m_sigs_oldvalp) VL_DO_CLEAR(delete[] m_sigs_oldvalp, m_sigs_oldvalp = nullptr);
+    if (m_offloadShadowp) VL_DO_CLEAR(delete[] m_offloadShadowp, m_offloadShadowp = nullptr);
     if (m_sigs_enabledp) VL_DO_CLEAR(delete[] m_sigs_enabledp, m_sigs_enabledp = nullptr);
+    if (m_sigs_enabledCountp) {
+        VL_DO_CLEAR(delete[] m_sigs_enabledCountp, m_sigs_enabledCountp = nullptr);
+    }
+    if (m_profilep) VL_DO_CLEAR(delete[] m_profilep, m_profilep = nullptr);
     Verilated::removeFlushCb(VerilatedTrace<VL_SUB_T, VL_BUF_T>::onFlush, this);
     Verilated::removeExitCb(VerilatedTrace<VL_SUB_T, VL_BUF_T>::onExit, this);
     if (offload()) closeBase();
+    for (VlWorkerThread* const workerp : m_parallelWorkers) delete workerp;
 }
 
 //=========================================================================
@@ -311,6 +544,7 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::traceInit() VL_MT_UNSAFE {
     m_numSignals = 0;
     m_maxBits = 0;
     m_sigs_enabledVec.clear();
+    m_profileDecls.clear();
 
     // Call all initialize callbacks, which will:
     // - Call decl* for each signal (these eventually call ::declCode)
@@ -325,21 +559,36 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::traceInit() VL_MT_UNSAFE {
     // Now that we know the number of codes, allocate space for the buffer
     // holding previous signal values.
     if (!m_sigs_oldvalp) m_sigs_oldvalp = new uint32_t[nextCode()];
+    // And the profiler counts, which accumulate across re-opens
+    if (!m_profileFilename.empty()) {
+        if (!m_profilep) m_profilep = new uint64_t[2 * nextCode()]{0};
+        m_profileDecls.resize(nextCode());
+    }
 
     // Apply enables
     if (m_sigs_enabledp) VL_DO_CLEAR(delete[] m_sigs_enabledp, m_sigs_enabledp = nullptr);
-    if (!m_sigs_enabledVec.empty()) {
+    if (m_sigs_enabledCountp) {
+        VL_DO_CLEAR(delete[] m_sigs_enabledCountp, m_sigs_enabledCountp = nullptr);
+    }
+    if (!m_sigs_enabledVec.empty() || !m_dumpScopeIncludes.empty()
+        || !m_dumpScopeExcludes.empty()) {
         // Else if was empty, m_sigs_enabledp = nullptr to short circuit tests
         // But it isn't, so alloc one bit for each code to indicate enablement
         // We don't want to still use m_signs_enabledVec as std::vector<bool> is not
         // guaranteed to be fast
         m_sigs_enabledp = new uint32_t[1 + VL_WORDS_I(nextCode())]{0};
-        m_sigs_enabledVec.reserve(nextCode());
+        // Also count the enabled codes, so whole trace functions can be skipped
+        m_sigs_enabledCountp = new uint32_t[nextCode() + 1];
+        m_sigs_enabledVec.resize(std::max<size_t>(m_sigs_enabledVec.size(), nextCode()));
+        uint32_t count = 0;
         for (size_t code = 0; code < nextCode(); ++code) {
+            m_sigs_enabledCountp[code] = count;
             if (m_sigs_enabledVec[code]) {
                 m_sigs_enabledp[VL_BITWORD_I(code)] |= 1U << VL_BITBIT_I(code);
+                ++count;
             }
         }
+        m_sigs_enabledCountp[nextCode()] = count;
         m_sigs_enabledVec.clear();
     }
 
@@ -352,8 +601,11 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::traceInit() VL_MT_UNSAFE {
         // each signal, which is 'nextCode()' entries after the init callbacks
         // above have been run, plus up to 2 more words of metadata per signal,
         // plus fixed overhead of 1 for a termination flag and 3 for a time stamp
-        // update.
+        // update. Wide values are only delta encoded when that is smaller, so
+        // this also bounds CHG_WDATA_DELTA.
         m_offloadBufferSize = nextCode() + numSignals() * 2 + 4;
+        // The values last sent to the worker, set by the full dumps
+        if (!m_offloadShadowp) m_offloadShadowp = new uint32_t[nextCode()];
 
         // Start the worker thread
         m_workerThread.reset(
@@ -361,6 +613,60 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::traceInit() VL_MT_UNSAFE {
     }
 }
 
+// Match 'str' against 'glob', where '*' matches any string and '?' any character
+static bool verilatedTraceGlobMatch(const char* globp, const char* strp) {
+    for (; *globp; ++globp, ++strp) {
+        if (*globp == '*') {
+            while (!verilatedTraceGlobMatch(globp + 1, strp)) {
+                if (!*strp++) return false;
+            }
+            return true;
+        }
+        if (!*strp || (*globp != '?' && *globp != *strp)) return false;
+    }
+    return !*strp;
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dumpScopeAdd(const std::string& glob, bool include)
+    VL_REQUIRES(m_mutex) {
+    // Convert Verilog . separators to trace space separators
+    std::string globSpaced = glob;
+    for (auto& i : globSpaced) {
+        if (i == '.') i = ' ';
+    }
+    (include ? m_dumpScopeIncludes : m_dumpScopeExcludes).push_back(globSpaced);
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dumpScope(const std::string& glob, bool include)
+    VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    dumpScopeAdd(glob, include);
+}
+
+template <>
+bool VerilatedTrace<VL_SUB_T, VL_BUF_T>::dumpScopeEnabled(const std::string& declName) const {
+    // A glob matches a signal if it matches the signal, or any scope above it
+    bool included = m_dumpScopeIncludes.empty();
+    size_t pos = 0;
+    while (pos != std::string::npos) {
+        pos = declName.find(' ', pos + 1);
+        const std::string prefix = declName.substr(0, pos);
+        for (const std::string& glob : m_dumpScopeExcludes) {
+            if (verilatedTraceGlobMatch(glob.c_str(), prefix.c_str())) return false;
+        }
+        if (included) continue;
+        for (const std::string& glob : m_dumpScopeIncludes) {
+            if (verilatedTraceGlobMatch(glob.c_str(), prefix.c_str())) {
+                included = true;
+                break;
+            }
+        }
+    }
+    return included;
+}
+
 template <>
 bool VerilatedTrace<VL_SUB_T, VL_BUF_T>::declCode(uint32_t code, const std::string& declName,
                                                   uint32_t bits) {
@@ -385,12 +691,25 @@ bool VerilatedTrace<VL_SUB_T, VL_BUF_T>::declCode(uint32_t code, const std::stri
             if (*np++ == ' ') ++levels;
         }
         if (levels > dumpvarsLevel) continue;  // Too deep
+        enabled = true;
+        break;
+    }
+    if (enabled && (!m_dumpScopeIncludes.empty() || !m_dumpScopeExcludes.empty())) {
+        enabled = dumpScopeEnabled(declName);
+    }
+    if (enabled
+        && (!m_dumpvars.empty() || !m_dumpScopeIncludes.empty()
+            || !m_dumpScopeExcludes.empty())) {
         // We only need to set first code word if it's a multicode signal
         // as that's all we'll check for later
         if (m_sigs_enabledVec.size() <= code) m_sigs_enabledVec.resize((code + 1024) * 2);
         m_sigs_enabledVec[code] = true;
-        enabled = true;
-        break;
+    }
+
+    // Name each code after its first declaration, aliases add no cost
+    if (!m_profileFilename.empty()) {
+        if (m_profileDecls.size() <= code) m_profileDecls.resize((code + 1024) * 2);
+        if (m_profileDecls[code].first.empty()) m_profileDecls[code] = {declName, bits};
     }
 
     int codesNeeded = VL_WORDS_I(bits);
@@ -441,6 +760,79 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dumpvars(int level, const std::string&
     }
 }
 
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dumpWindow(uint64_t start, uint64_t end) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_dumpWindows.emplace_back(start, end);
+    m_dumpGated = true;
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dumpTrigger(const std::string& signal) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_dumpTriggerName = signal;
+    m_dumpTriggerp = nullptr;
+    m_dumpTriggerFind.store(!signal.empty());
+    m_dumpGated = m_dumpGated || !signal.empty();
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dumpOn(bool flag) VL_MT_SAFE {
+    const VerilatedLockGuard lock{m_mutex};
+    m_dumpOn = flag;
+    m_dumpGated = m_dumpGated || !flag;
+}
+
+template <>
+bool VerilatedTrace<VL_SUB_T, VL_BUF_T>::dumpGate(uint64_t timeui) {
+    if (!m_dumpOn) return false;
+    if (!m_dumpWindows.empty()) {
+        bool inWindow = false;
+        for (const auto& window : m_dumpWindows) {
+            if (timeui >= window.first && timeui <= window.second) {
+                inWindow = true;
+                break;
+            }
+        }
+        if (!inWindow) return false;
+    }
+    if (m_dumpTriggerp) {
+        const uint8_t* const datap = static_cast<const uint8_t*>(m_dumpTriggerp->datap());
+        const uint32_t size = m_dumpTriggerp->entSize();
+        bool triggered = false;
+        for (uint32_t i = 0; i < size; ++i) triggered |= datap[i] != 0;
+        if (!triggered) return false;
+    }
+    return true;
+}
+
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dumpTriggerFind() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    // Look up on first use, as the scopes only exist once the model is built.
+    // Not under the mutex, as not finding it is fatal, which calls the flush
+    // callbacks, which need the mutex
+    std::string name;
+    {
+        const VerilatedLockGuard lock{m_mutex};
+        name = m_dumpTriggerName;
+    }
+    if (name.empty()) return;  // dumpTrigger("") meanwhile
+    const size_t dot = name.rfind('.');
+    const VerilatedScope* const scopep
+        = dot == std::string::npos ? nullptr
+                                   : m_contextp->scopeFind(name.substr(0, dot).c_str());
+    const VerilatedVar* const varp = scopep ? scopep->varFind(name.c_str() + dot + 1) : nullptr;
+    if (VL_UNLIKELY(!varp)) {
+        const std::string msg = "Trace trigger signal not found, or not public: " + name;
+        VL_FATAL_MT(__FILE__, __LINE__, "", msg.c_str());
+    }
+    const VerilatedLockGuard lock{m_mutex};
+    // Unless dumpTrigger() changed the signal meanwhile
+    if (name != m_dumpTriggerName) return;
+    m_dumpTriggerp = varp;
+    m_dumpTriggerFind.store(false);
+}
+
 template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::parallelWorkerTask(void* datap, bool) {
     ParallelWorkerData* const wdp = reinterpret_cast<ParallelWorkerData*>(datap);
@@ -469,12 +861,15 @@ VL_ATTR_NOINLINE void VerilatedTrace<VL_SUB_T, VL_BUF_T>::ParallelWorkerData::wa
 template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runCallbacks(const std::vector<CallbackRecord>& cbVec) {
     if (parallel()) {
-        // If tracing in parallel, dispatch to the thread pool
-        VlThreadPool* threadPoolp = static_cast<VlThreadPool*>(m_contextp->threadPoolp());
+        // If tracing in parallel, dispatch to our own workers, or the thread pool
+        VlThreadPool* const threadPoolp
+            = m_parallelWorkers.empty() ? static_cast<VlThreadPool*>(m_contextp->threadPoolp())
+                                        : nullptr;
         // List of work items for thread (std::list, as ParallelWorkerData is not movable)
         std::list<ParallelWorkerData> workerData;
-        // We use the whole pool + the main thread
-        const unsigned threads = threadPoolp->numThreads() + 1;
+        // We use all the workers + the main thread
+        const unsigned threads
+            = (threadPoolp ? threadPoolp->numThreads() : m_parallelWorkers.size()) + 1;
         // Main thread executes all jobs with index % threads == 0
         std::vector<ParallelWorkerData*> mainThreadWorkerData;
         // Enqueue all the jobs
@@ -485,9 +880,13 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runCallbacks(const std::vector<Callback
             workerData.emplace_back(cbr.m_dumpCb, cbr.m_userp, bufp);
             // Grab the new work item
             ParallelWorkerData* const itemp = &workerData.back();
+            // Flight recorder commands are kept per item, and appended in order
+            if (bufp->m_recordp) bufp->m_recordp = &itemp->m_record;
             // Enqueue task to thread pool, or main thread
             if (unsigned rem = cbr.m_fidx % threads) {
-                threadPoolp->workerp(rem - 1)->addTask(parallelWorkerTask, itemp);
+                VlWorkerThread* const workerp
+                    = threadPoolp ? threadPoolp->workerp(rem - 1) : m_parallelWorkers[rem - 1];
+                workerp->addTask(parallelWorkerTask, itemp);
             } else {
                 mainThreadWorkerData.push_back(itemp);
             }
@@ -500,6 +899,10 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runCallbacks(const std::vector<Callback
         for (ParallelWorkerData& item : workerData) {
             // Wait until ready
             item.wait();
+            if (VL_UNLIKELY(!item.m_record.empty())) {
+                m_recorderCur.insert(m_recorderCur.end(), item.m_record.begin(),
+                                     item.m_record.end());
+            }
             // Commit the buffer
             commitTraceBuffer(item.m_bufp);
         }
@@ -526,12 +929,30 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::runOffloadedCallbacks(
     }
 }
 
+template <>
+void VerilatedTrace<VL_SUB_T, VL_BUF_T>::recorderRotate() {
+    // The offload worker thread may still be recording into the current segment
+    if (offload()) flushBase();
+    // Keep one complete segment, so at least the last m_recorderDumps dumps are kept
+    std::swap(m_recorderPrev, m_recorderCur);
+    m_recorderCur.clear();
+    // Each segment starts with a full dump, so it does not depend on the earlier ones
+    m_fullDump = true;
+    m_constDump = true;
+}
+
 template <>
 void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dump(uint64_t timeui) VL_MT_SAFE_EXCLUDES(m_mutex) {
     // Not really VL_MT_SAFE but more VL_MT_UNSAFE_ONE.
     // This does get the mutex, but if multiple threads are trying to dump
     // chances are the data being dumped will have other problems
+    // Find the trigger signal before getting the mutex, as not finding it
+    // is fatal, which calls the flush callbacks, which need the mutex
+    if (VL_UNLIKELY(m_dumpTriggerFind.load())) dumpTriggerFind();
     const VerilatedLockGuard lock{m_mutex};
+    // Skipped dumps do not run the cleanup callbacks, so the activity flags
+    // stay set, and the next dump still finds all the changes since the last one
+    if (VL_UNLIKELY(m_dumpGated) && !dumpGate(timeui)) return;
     if (VL_UNCOVERABLE(m_didSomeDump && timeui <= m_timeLastDump)) {  // LCOV_EXCL_START
         VL_PRINTF_MT("%%Warning: previous dump at t=%" PRIu64 ", requesting t=%" PRIu64
                      ", dump call ignored\n",
@@ -541,6 +962,11 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dump(uint64_t timeui) VL_MT_SAFE_EXCLUD
     m_timeLastDump = timeui;
     m_didSomeDump = true;
 
+    // Start a new flight recorder segment every m_recorderDumps dumps
+    if (VL_UNLIKELY(m_recorderDumps) && !(m_recorderCount++ % m_recorderDumps)) {
+        recorderRotate();
+    }
+
     Verilated::quiesce();
 
     // Call hook for format-specific behaviour
@@ -569,11 +995,11 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dump(uint64_t timeui) VL_MT_SAFE_EXCLUD
         } else {
             // Update time point
             flushBase();
-            emitTimeChange(timeui);
+            timeChange(timeui);
         }
     } else {
         // Update time point
-        emitTimeChange(timeui);
+        timeChange(timeui);
     }
 
     // Run the callbacks
@@ -616,6 +1042,10 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::dump(uint64_t timeui) VL_MT_SAFE_EXCLUD
 
         // Pass it to the worker thread
         m_offloadBuffersToWorker.put(bufferp);
+    } else if (offload()) {
+        // Full dumps run on this thread, so the worker has the same previous
+        // values as we do, use them as the base of the following deltas
+        std::memcpy(m_offloadShadowp, m_sigs_oldvalp, nextCode() * sizeof(uint32_t));
     }
 }
 
@@ -649,6 +1079,28 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::addModel(VerilatedModel* modelp)
     // Keep hold of the context
     m_contextp = contextp;
 
+    // Apply +verilator+trace+ runtime arguments
+    if (firstModel) {
+        if (contextp->traceStart() != 0
+            || contextp->traceEnd() != std::numeric_limits<uint64_t>::max()) {
+            m_dumpWindows.emplace_back(contextp->traceStart(), contextp->traceEnd());
+            m_dumpGated = true;
+        }
+        for (const auto& scope : contextp->traceScopes()) {
+            dumpScopeAdd(scope.first, scope.second);
+        }
+        if (contextp->traceRecorder()) m_recorderDumps = contextp->traceRecorder();
+        const std::string profile = contextp->traceProfile();
+        if (!profile.empty()) m_profileFilename = profile;
+        const std::string trigger = contextp->traceTrigger();
+        if (!trigger.empty()) {
+            m_dumpTriggerName = trigger;
+            m_dumpTriggerp = nullptr;
+            m_dumpTriggerFind.store(true);
+            m_dumpGated = true;
+        }
+    }
+
     // Get the desired trace config from the model
     const std::unique_ptr<VerilatedTraceConfig> configp = modelp->traceConfig();
 
@@ -667,6 +1119,11 @@ void VerilatedTrace<VL_SUB_T, VL_BUF_T>::addModel(VerilatedModel* modelp)
         VL_FATAL_MT(__FILE__, __LINE__, "", "Cannot use parallel tracing with offloading");
     }  // LCOV_EXCL_STOP
 
+    // Start the worker threads for parallel tracing, if the model wants our own
+    while (m_parallelWorkers.size() < configp->m_parallelThreads) {
+        m_parallelWorkers.push_back(new VlWorkerThread{contextp});
+    }
+
     // Configure format-specific sub class
     configure(*(configp.get()));
 }
@@ -815,7 +1272,10 @@ template <>
 VerilatedTraceBuffer<VL_BUF_T>::VerilatedTraceBuffer(Trace& owner)
     : VL_BUF_T{owner}
     , m_sigs_oldvalp{owner.m_sigs_oldvalp}
-    , m_sigs_enabledp{owner.m_sigs_enabledp} {}
+    , m_sigs_enabledp{owner.m_sigs_enabledp}
+    , m_sigs_enabledCountp{owner.m_sigs_enabledCountp}
+    , m_recordp{owner.m_recorderDumps ? &owner.m_recorderCur : nullptr}
+    , m_profilep{owner.m_profilep} {}
 
 // These functions must write the new value back into the old value store,
 // and subsequently call the format-specific emit* implementations. Note
@@ -827,6 +1287,11 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullBit(uint32_t* oldp, CData newval) {
     const uint32_t code = oldp - m_sigs_oldvalp;
     *oldp = newval;  // Still copy even if not tracing so chg doesn't call full
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
+    if (VL_UNLIKELY(m_profilep)) profile(code, 1);
+    if (VL_UNLIKELY(m_recordp)) {
+        record(VerilatedTraceOffloadCommand::CHG_BIT_0 | newval, code, nullptr, 0);
+        return;
+    }
     emitBit(code, newval);
 }
 
@@ -834,13 +1299,24 @@ template <>
 void VerilatedTraceBuffer<VL_BUF_T>::fullEvent(uint32_t* oldp, const VlEventBase* newvalp) {
     const uint32_t code = oldp - m_sigs_oldvalp;
     // No need to update *oldp
-    if (newvalp->isTriggered()) emitEvent(code);
+    if (!newvalp->isTriggered()) return;
+    if (VL_UNLIKELY(m_profilep)) profile(code, 0);
+    if (VL_UNLIKELY(m_recordp)) {
+        record(VerilatedTraceOffloadCommand::CHG_EVENT, code, nullptr, 0);
+        return;
+    }
+    emitEvent(code);
 }
 
 template <>
 void VerilatedTraceBuffer<VL_BUF_T>::fullEventTriggered(uint32_t* oldp) {
     const uint32_t code = oldp - m_sigs_oldvalp;
     // No need to update *oldp
+    if (VL_UNLIKELY(m_profilep)) profile(code, 0);
+    if (VL_UNLIKELY(m_recordp)) {
+        record(VerilatedTraceOffloadCommand::CHG_EVENT, code, nullptr, 0);
+        return;
+    }
     emitEvent(code);
 }
 
@@ -849,6 +1325,11 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullCData(uint32_t* oldp, CData newval, int
     const uint32_t code = oldp - m_sigs_oldvalp;
     *oldp = newval;  // Still copy even if not tracing so chg doesn't call full
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
+    if (VL_UNLIKELY(m_profilep)) profile(code, VL_BYTES_I(bits));
+    if (VL_UNLIKELY(m_recordp)) {
+        record((bits << 4) | VerilatedTraceOffloadCommand::CHG_CDATA, code, oldp, 1);
+        return;
+    }
     emitCData(code, newval, bits);
 }
 
@@ -857,6 +1338,11 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullSData(uint32_t* oldp, SData newval, int
     const uint32_t code = oldp - m_sigs_oldvalp;
     *oldp = newval;  // Still copy even if not tracing so chg doesn't call full
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
+    if (VL_UNLIKELY(m_profilep)) profile(code, VL_BYTES_I(bits));
+    if (VL_UNLIKELY(m_recordp)) {
+        record((bits << 4) | VerilatedTraceOffloadCommand::CHG_SDATA, code, oldp, 1);
+        return;
+    }
     emitSData(code, newval, bits);
 }
 
@@ -865,6 +1351,11 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullIData(uint32_t* oldp, IData newval, int
     const uint32_t code = oldp - m_sigs_oldvalp;
     *oldp = newval;  // Still copy even if not tracing so chg doesn't call full
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
+    if (VL_UNLIKELY(m_profilep)) profile(code, VL_BYTES_I(bits));
+    if (VL_UNLIKELY(m_recordp)) {
+        record((bits << 4) | VerilatedTraceOffloadCommand::CHG_IDATA, code, oldp, 1);
+        return;
+    }
     emitIData(code, newval, bits);
 }
 
@@ -873,6 +1364,11 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullQData(uint32_t* oldp, QData newval, int
     const uint32_t code = oldp - m_sigs_oldvalp;
     std::memcpy(oldp, &newval, sizeof(newval));
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
+    if (VL_UNLIKELY(m_profilep)) profile(code, VL_BYTES_I(bits));
+    if (VL_UNLIKELY(m_recordp)) {
+        record((bits << 4) | VerilatedTraceOffloadCommand::CHG_QDATA, code, oldp, 2);
+        return;
+    }
     emitQData(code, newval, bits);
 }
 
@@ -881,6 +1377,12 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullWData(uint32_t* oldp, const WData* newv
     const uint32_t code = oldp - m_sigs_oldvalp;
     for (int i = 0; i < VL_WORDS_I(bits); ++i) oldp[i] = newvalp[i];
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
+    if (VL_UNLIKELY(m_profilep)) profile(code, VL_BYTES_I(bits));
+    if (VL_UNLIKELY(m_recordp)) {
+        record((bits << 4) | VerilatedTraceOffloadCommand::CHG_WDATA, code, oldp,
+               VL_WORDS_I(bits));
+        return;
+    }
     emitWData(code, newvalp, bits);
 }
 
@@ -889,6 +1391,11 @@ void VerilatedTraceBuffer<VL_BUF_T>::fullDouble(uint32_t* oldp, double newval) {
     const uint32_t code = oldp - m_sigs_oldvalp;
     std::memcpy(oldp, &newval, sizeof(newval));
     if (VL_UNLIKELY(m_sigs_enabledp && !(VL_BITISSET_W(m_sigs_enabledp, code)))) return;
+    if (VL_UNLIKELY(m_profilep)) profile(code, sizeof(double));
+    if (VL_UNLIKELY(m_recordp)) {
+        record(VerilatedTraceOffloadCommand::CHG_DOUBLE, code, oldp, 2);
+        return;
+    }
     // cppcheck-suppress invalidPointerCast
     emitDouble(code, newval);
 }
@@ -900,7 +1407,8 @@ template <>
 VerilatedTraceOffloadBuffer<VL_BUF_T>::VerilatedTraceOffloadBuffer(VL_SUB_T& owner)
     : VerilatedTraceBuffer<VL_BUF_T>{owner}
     , m_offloadBufferWritep{owner.m_offloadBufferWritep}
-    , m_offloadBufferEndp{owner.m_offloadBufferEndp} {
+    , m_offloadBufferEndp{owner.m_offloadBufferEndp}
+    , m_offloadShadowp{owner.m_offloadShadowp} {
     if (m_offloadBufferWritep) {
         using This = VerilatedTraceBuffer<VL_BUF_T>*;
         // Tack on the buffer address
@@ -912,4 +1420,52 @@ VerilatedTraceOffloadBuffer<VL_BUF_T>::VerilatedTraceOffloadBuffer(VL_SUB_T& own
     }
 }
 
+template <>
+void VerilatedTraceOffloadBuffer<VL_BUF_T>::chgWData(uint32_t code, const WData* newvalp,
+                                                     int bits) {
+    const int words = VL_WORDS_I(bits);
+    uint32_t* const shadowp = m_offloadShadowp + code;
+    uint32_t* const startp = m_offloadBufferWritep;
+    // Encode as runs of changed words: a header with the number of unchanged
+    // words skipped and the number of words in the run, then the XOR of the
+    // old and new value of each word in the run. Unchanged signals are not
+    // sent at all. Give up on the encoding when it is no smaller than the
+    // full value, which also keeps us within the offload buffer size.
+    uint32_t* const limitp = startp + 2 + words;
+    uint32_t* writep = startp + 3;
+    uint32_t nRuns = 0;
+    int i = 0;
+    int end = 0;  // End of previous run
+    while (words <= 0xffff) {
+        while (i < words && shadowp[i] == newvalp[i]) ++i;
+        if (i == words) break;
+        if (writep >= limitp) break;
+        uint32_t* const headerp = writep++;
+        const int begin = i;
+        for (; i < words && writep < limitp; ++i) {
+            const uint32_t diff = shadowp[i] ^ newvalp[i];
+            if (!diff) break;
+            *writep++ = diff;
+            shadowp[i] = newvalp[i];
+        }
+        *headerp = static_cast<uint32_t>(begin - end) << 16 | static_cast<uint32_t>(i - begin);
+        end = i;
+        ++nRuns;
+    }
+    if (VL_LIKELY(i == words)) {
+        if (!nRuns) return;
+        startp[0] = (bits << 4) | VerilatedTraceOffloadCommand::CHG_WDATA_DELTA;
+        startp[1] = code;
+        startp[2] = nRuns;
+        m_offloadBufferWritep = writep;
+    } else {
+        // Send the full value
+        startp[0] = (bits << 4) | VerilatedTraceOffloadCommand::CHG_WDATA;
+        startp[1] = code;
+        for (int w = 0; w < words; ++w) startp[2 + w] = shadowp[w] = newvalp[w];
+        m_offloadBufferWritep = startp + 2 + words;
+    }
+    VL_DEBUG_IF(assert(m_offloadBufferWritep <= m_offloadBufferEndp););
+}
+
 #endif  // VL_CPPCHECK
@@ -0,0 +1,500 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated C++ tracing in VBT format implementation code
+///
+/// This file must be compiled and linked against all Verilated objects
+/// that use --trace-vbt.
+///
+/// Use "verilator --trace-vbt" to add this to the Makefile for the linker.
+///
+//=============================================================================
+// File layout, all integers are little endian, strings are a u32 length
+// followed by the characters:
+//
+//   Header:  "VLVBT001", str timescale, u32 number of codes,
+//            u32 state bytes, u32 declaration bytes, declaration records
+//   Chunk:   "VBTC", u32 number of times, u32 number of changed signals,
+//            u32 payload bytes, u32 compressed bytes,
+//            u64 time[number of times],
+//            {u32 code, u32 payload offset, u32 changes}[number of changed signals],
+//            LZ4 compressed payload
+//   Index:   "VBTI", u32 number of chunks,
+//            {u64 chunk offset, u64 first time, u64 last time}[number of chunks]
+//   Trailer: u64 index offset, "VBTEND01"
+//
+// Declaration records are 'S' u8 scope type, str name; 'U' (upscope); or
+// 'V' u32 code, u32 bits, u8 kind (0 = bits, 1 = real, 2 = event),
+// str VCD variable type, str name.
+//
+// A chunk payload starts with the value of all signals at the start of the
+// chunk, each code at its offset in declaration order, followed by the
+// changes of each signal as {u32 time number, value} in time order. Values
+// are (bits + 7) / 8 bytes, 8 bytes for reals, and none for events. Each
+// chunk is therefore decodable on its own, and the index allows finding
+// the chunks of a time window without reading the others.
+//=============================================================================
+
+// clang-format off
+
+#include "verilatedos.h"
+#include "verilated.h"
+#include "verilated_vbt_c.h"
+
+// GTKWave configuration, as used by verilated_fst_c.cpp
+#define LZ4_DISABLE_DEPRECATE_WARNINGS
+
+// Include the LZ4 implementation directly. verilated_fst_c.cpp includes it
+// too, so give this copy internal linkage (or private names, for the
+// functions LZ4 declares without LZ4LIB_API), so both trace formats may be
+// linked into one program.
+#define LZ4LIB_VISIBILITY static
+#define LZ4_PUBLISH_STATIC_FUNCTIONS
+#define LZ4_compress_forceExtDict vl_vbt_LZ4_compress_forceExtDict
+#define LZ4_decompress_safe_forceExtDict vl_vbt_LZ4_decompress_safe_forceExtDict
+#define LZ4_decompress_safe_partial_forceExtDict vl_vbt_LZ4_decompress_safe_partial_forceExtDict
+#define LZ4_compress_destSize_extState vl_vbt_LZ4_compress_destSize_extState
+#ifdef __GNUC__
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wunused-function"  // Static LZ4 API not used here
+#endif
+#include "gtkwave/lz4.c"
+#ifdef __GNUC__
+# pragma GCC diagnostic pop
+#endif
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+
+#if defined(_WIN32) && !defined(__MINGW32__) && !defined(__CYGWIN__)
+# include <io.h>
+#else
+# include <unistd.h>
+#endif
+
+#ifndef O_LARGEFILE  // WIN32 headers omit this
+# define O_LARGEFILE 0
+#endif
+#ifndef O_CLOEXEC  // WIN32 headers omit this
+# define O_CLOEXEC 0
+#endif
+#ifndef O_BINARY  // Only WIN32 headers have this
+# define O_BINARY 0
+#endif
+
+// clang-format on
+
+constexpr uint32_t VL_VBT_NO_STATE = ~0U;  // m_stateOffsets value for undeclared codes
+
+//=============================================================================
+// Specialization of the generics for this trace format
+
+#define VL_SUB_T VerilatedVbt
+#define VL_BUF_T VerilatedVbtBuffer
+#include "verilated_trace_imp.h"
+#undef VL_SUB_T
+#undef VL_BUF_T
+
+//=============================================================================
+// Little endian encoding
+
+static void vbtPut32(std::string& str, uint32_t val) {
+    for (int i = 0; i < 4; ++i) str += static_cast<char>(val >> (8 * i));
+}
+static void vbtPut64(std::string& str, uint64_t val) {
+    for (int i = 0; i < 8; ++i) str += static_cast<char>(val >> (8 * i));
+}
+static void vbtPutStr(std::string& str, const std::string& val) {
+    vbtPut32(str, static_cast<uint32_t>(val.size()));
+    str += val;
+}
+static inline void vbtStore32(char* bufp, uint32_t val) {
+    for (int i = 0; i < 4; ++i) bufp[i] = static_cast<char>(val >> (8 * i));
+}
+static inline uint32_t vbtLoad32(const char* bufp) {
+    uint32_t val = 0;
+    for (int i = 3; i >= 0; --i) val = (val << 8) | static_cast<uint8_t>(bufp[i]);
+    return val;
+}
+
+//=============================================================================
+// VerilatedVbt
+
+VerilatedVbt::VerilatedVbt(void* /*filep*/) {}
+
+VerilatedVbt::~VerilatedVbt() { close(); }
+
+void VerilatedVbt::open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    if (isOpen()) return;
+
+    m_filename = filename;  // "" is ok, as someone may overload open
+    m_fd = ::open(m_filename.c_str(),
+                  O_CREAT | O_WRONLY | O_TRUNC | O_LARGEFILE | O_CLOEXEC | O_BINARY, 0666);
+    if (m_fd < 0) return;
+    m_isOpen = true;
+    m_fileOffset = 0;
+    m_index.clear();
+    m_decls.clear();
+    constDump(true);  // First dump must contain the const signals
+    fullDump(true);  // First dump must be full, as it provides the first chunk's values
+
+    Super::traceInit();
+
+    // Codes may be sparse, declare() sized these only up to the last declared code
+    m_codeBytes.resize(nextCode(), 0);
+    m_stateOffsets.resize(nextCode(), VL_VBT_NO_STATE);
+    m_cursors.resize(nextCode());
+
+    std::string header = "VLVBT001";
+    vbtPutStr(header, timeResStr());
+    vbtPut32(header, nextCode());
+    vbtPut32(header, static_cast<uint32_t>(m_state.size()));
+    vbtPut32(header, static_cast<uint32_t>(m_decls.size()));
+    header += m_decls;
+    writeBytes(header.data(), header.size());
+    m_decls.clear();
+    m_decls.shrink_to_fit();
+}
+
+void VerilatedVbt::close() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    // This function is on the flush() call path
+    const VerilatedLockGuard lock{m_mutex};
+    if (!isOpen()) return;
+    Super::closeBase();
+    writeChunk();
+    writeIndex();
+    ::close(m_fd);
+    m_fd = -1;
+    m_isOpen = false;
+}
+
+void VerilatedVbt::flush() VL_MT_SAFE_EXCLUDES(m_mutex) {
+    const VerilatedLockGuard lock{m_mutex};
+    if (!isOpen()) return;
+    Super::flushBase();
+    writeChunk();
+}
+
+void VerilatedVbt::emitTimeChange(uint64_t timeui) {
+    // Chunks end only between time points, so each one has whole time steps
+    if (VL_UNLIKELY(m_rawUsed >= m_chunkSize)) writeChunk();
+    m_times.push_back(timeui);
+    m_timeOffsets.push_back(m_rawUsed);
+}
+
+void VerilatedVbt::writeBytes(const void* datap, size_t size) {
+    const char* bufp = static_cast<const char*>(datap);
+    m_fileOffset += size;
+    while (size > 0) {
+        const ssize_t got = ::write(m_fd, bufp, size);
+        if (VL_UNLIKELY(got <= 0)) {
+            if (got < 0 && (errno == EAGAIN || errno == EINTR)) continue;
+            // LCOV_EXCL_START
+            VL_PRINTF_MT("%%Error: Write error on %s: %s\n", m_filename.c_str(),
+                         std::strerror(errno));
+            return;
+            // LCOV_EXCL_STOP
+        }
+        bufp += got;
+        size -= got;
+    }
+}
+
+void VerilatedVbt::writeChunk() {
+    if (m_times.empty()) return;
+    const char* const rawp = m_raw.data();
+
+    // Count changes per signal, and lay out each signal's changes after the state
+    std::fill(m_cursors.begin(), m_cursors.end(), 0);
+    for (size_t pos = 0; pos < m_rawUsed;) {
+        const uint32_t code = vbtLoad32(rawp + pos);
+        ++m_cursors[code];
+        pos += 4 + m_codeBytes[code];
+    }
+    std::string header = "VBTC";
+    std::string sigTable;
+    uint32_t numSigs = 0;
+    size_t payloadSize = m_state.size();
+    for (uint32_t code = 0; code < m_cursors.size(); ++code) {
+        const uint32_t changes = m_cursors[code];
+        if (!changes) continue;
+        ++numSigs;
+        vbtPut32(sigTable, code);
+        vbtPut32(sigTable, static_cast<uint32_t>(payloadSize));
+        vbtPut32(sigTable, changes);
+        m_cursors[code] = static_cast<uint32_t>(payloadSize);
+        payloadSize += changes * (4 + m_codeBytes[code]);
+    }
+
+    // Fill payload, updating the state to the end of this chunk as we go
+    m_payload.resize(payloadSize);
+    char* const payloadp = m_payload.data();
+    if (!m_state.empty()) std::memcpy(payloadp, m_state.data(), m_state.size());
+    size_t timeNum = 0;
+    for (size_t pos = 0; pos < m_rawUsed;) {
+        while (timeNum + 1 < m_timeOffsets.size() && m_timeOffsets[timeNum + 1] <= pos) {
+            ++timeNum;
+        }
+        const uint32_t code = vbtLoad32(rawp + pos);
+        const uint32_t bytes = m_codeBytes[code];
+        char* const entryp = payloadp + m_cursors[code];
+        vbtStore32(entryp, static_cast<uint32_t>(timeNum));
+        if (bytes) {
+            std::memcpy(entryp + 4, rawp + pos + 4, bytes);
+            std::memcpy(m_state.data() + m_stateOffsets[code], rawp + pos + 4, bytes);
+        }
+        m_cursors[code] += 4 + bytes;
+        pos += 4 + bytes;
+    }
+
+    // Compress
+    const int bound = LZ4_compressBound(static_cast<int>(payloadSize));
+    m_compressed.resize(bound);
+    const int compSize = LZ4_compress_default(payloadp, m_compressed.data(),
+                                              static_cast<int>(payloadSize), bound);
+
+    m_index.push_back({m_fileOffset, m_times.front(), m_times.back()});
+    vbtPut32(header, static_cast<uint32_t>(m_times.size()));
+    vbtPut32(header, numSigs);
+    vbtPut32(header, static_cast<uint32_t>(payloadSize));
+    vbtPut32(header, static_cast<uint32_t>(compSize));
+    for (const uint64_t time : m_times) vbtPut64(header, time);
+    header += sigTable;
+    writeBytes(header.data(), header.size());
+    writeBytes(m_compressed.data(), compSize);
+
+    m_rawUsed = 0;
+    m_times.clear();
+    m_timeOffsets.clear();
+}
+
+void VerilatedVbt::writeIndex() {
+    const uint64_t indexOffset = m_fileOffset;
+    std::string index = "VBTI";
+    vbtPut32(index, static_cast<uint32_t>(m_index.size()));
+    for (const ChunkIndex& chunk : m_index) {
+        vbtPut64(index, chunk.m_offset);
+        vbtPut64(index, chunk.m_startTime);
+        vbtPut64(index, chunk.m_endTime);
+    }
+    vbtPut64(index, indexOffset);
+    index += "VBTEND01";
+    writeBytes(index.data(), index.size());
+}
+
+//=============================================================================
+// Decl
+
+void VerilatedVbt::pushPrefix(const char* namep, VerilatedTracePrefixType type) {
+    assert(!m_prefixStack.empty());  // Constructor makes an empty entry
+    const std::string name{namep};
+    // An empty name means this is the root of a model created with
+    // name()=="".  The tools get upset if we try to pass this as empty, so
+    // we put the signals under a new $rootio scope, but the signals
+    // further down will be peers, not children (as usual for name()!="").
+    const std::string prevPrefix = m_prefixStack.back().first;
+    if (name == "$rootio" && !prevPrefix.empty()) {
+        // Upper has name, we can suppress inserting $rootio, but still push so popPrefix works
+        m_prefixStack.emplace_back(prevPrefix, VerilatedTracePrefixType::ROOTIO_WRAPPER);
+        return;
+    } else if (name.empty()) {
+        m_prefixStack.emplace_back(prevPrefix, VerilatedTracePrefixType::ROOTIO_WRAPPER);
+        return;
+    }
+
+    const std::string newPrefix = prevPrefix + name;
+    bool properScope = false;
+    switch (type) {
+    case VerilatedTracePrefixType::SCOPE_MODULE:
+    case VerilatedTracePrefixType::SCOPE_INTERFACE:
+    case VerilatedTracePrefixType::STRUCT_PACKED:
+    case VerilatedTracePrefixType::STRUCT_UNPACKED:
+    case VerilatedTracePrefixType::UNION_PACKED: {
+        properScope = true;
+        break;
+    }
+    default: break;
+    }
+    if (properScope) {
+        m_decls += 'S';
+        m_decls += static_cast<char>(type);
+        vbtPutStr(m_decls, lastWord(newPrefix));
+    }
+    m_prefixStack.emplace_back(newPrefix + (properScope ? " " : ""), type);
+}
+
+void VerilatedVbt::popPrefix() {
+    assert(!m_prefixStack.empty());
+    switch (m_prefixStack.back().second) {
+    case VerilatedTracePrefixType::SCOPE_MODULE:
+    case VerilatedTracePrefixType::SCOPE_INTERFACE:
+    case VerilatedTracePrefixType::STRUCT_PACKED:
+    case VerilatedTracePrefixType::STRUCT_UNPACKED:
+    case VerilatedTracePrefixType::UNION_PACKED: m_decls += 'U'; break;
+    default: break;
+    }
+    m_prefixStack.pop_back();
+    assert(!m_prefixStack.empty());  // Always one left, the constructor's initial one
+}
+
+void VerilatedVbt::declare(uint32_t code, const char* name, const char* wirep, int kind,
+                           bool array, int arraynum, bool bussed, int msb, int lsb) {
+    const int bits = ((msb > lsb) ? (msb - lsb) : (lsb - msb)) + 1;
+
+    const std::string hierarchicalName = m_prefixStack.back().first + name;
+
+    const bool enabled = Super::declCode(code, hierarchicalName, bits);
+    if (!enabled) return;
+
+    if (m_codeBytes.size() <= code) {
+        m_codeBytes.resize(code + 1, 0);
+        m_stateOffsets.resize(code + 1, VL_VBT_NO_STATE);
+    }
+    if (m_stateOffsets[code] == VL_VBT_NO_STATE) {  // Else alias
+        m_codeBytes[code] = kind == 1 ? sizeof(double) : kind == 2 ? 0 : (bits + 7) / 8;
+        m_stateOffsets[code] = static_cast<uint32_t>(m_state.size());
+        m_state.resize(m_state.size() + m_codeBytes[code], 0);
+    }
+
+    std::string varName = lastWord(hierarchicalName);
+    if (array) varName += "[" + std::to_string(arraynum) + "]";
+    if (bussed) varName += " [" + std::to_string(msb) + ":" + std::to_string(lsb) + "]";
+
+    m_decls += 'V';
+    vbtPut32(m_decls, code);
+    vbtPut32(m_decls, bits);
+    m_decls += static_cast<char>(kind);
+    vbtPutStr(m_decls, wirep);
+    vbtPutStr(m_decls, varName);
+}
+
+void VerilatedVbt::declEvent(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                             VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                             VerilatedTraceSigType, bool array, int arraynum) {
+    declare(code, name, "event", 2, array, arraynum, false, 0, 0);
+}
+void VerilatedVbt::declBit(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                           VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                           VerilatedTraceSigType, bool array, int arraynum) {
+    declare(code, name, "wire", 0, array, arraynum, false, 0, 0);
+}
+void VerilatedVbt::declBus(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                           VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                           VerilatedTraceSigType, bool array, int arraynum, int msb, int lsb) {
+    declare(code, name, "wire", 0, array, arraynum, true, msb, lsb);
+}
+void VerilatedVbt::declQuad(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                            VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                            VerilatedTraceSigType, bool array, int arraynum, int msb, int lsb) {
+    declare(code, name, "wire", 0, array, arraynum, true, msb, lsb);
+}
+void VerilatedVbt::declArray(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                             VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                             VerilatedTraceSigType, bool array, int arraynum, int msb, int lsb) {
+    declare(code, name, "wire", 0, array, arraynum, true, msb, lsb);
+}
+void VerilatedVbt::declDouble(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                              VerilatedTraceSigDirection, VerilatedTraceSigKind,
+                              VerilatedTraceSigType, bool array, int arraynum) {
+    declare(code, name, "real", 1, array, arraynum, false, 63, 0);
+}
+
+//=============================================================================
+// Get/commit trace buffer
+
+VerilatedVbt::Buffer* VerilatedVbt::getTraceBuffer(uint32_t fidx) {
+    if (offload()) return new OffloadBuffer{*this};
+    return new Buffer{*this};
+}
+
+void VerilatedVbt::commitTraceBuffer(VerilatedVbt::Buffer* bufp) {
+    if (offload()) {
+        const OffloadBuffer* const offloadBufferp = static_cast<const OffloadBuffer*>(bufp);
+        if (offloadBufferp->m_offloadBufferWritep) {
+            m_offloadBufferWritep = offloadBufferp->m_offloadBufferWritep;
+            return;  // Buffer will be deleted by the offload thread
+        }
+    }
+    delete bufp;
+}
+
+//=============================================================================
+// VerilatedVbtBuffer implementation
+
+//=============================================================================
+// Trace rendering primitives
+
+// Note: emit* are only ever called from one place (full* in
+// verilated_trace_imp.h, which is included in this file at the top),
+// so always inline them.
+
+VL_ATTR_ALWINLINE
+char* VerilatedVbtBuffer::record(uint32_t code, size_t size) {
+    char* const recordp = m_owner.rawReserve(4 + size);
+    vbtStore32(recordp, code);
+    return recordp + 4;
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedVbtBuffer::emitEvent(uint32_t code) { record(code, 0); }
+
+VL_ATTR_ALWINLINE
+void VerilatedVbtBuffer::emitBit(uint32_t code, CData newval) {
+    *record(code, 1) = static_cast<char>(newval);
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedVbtBuffer::emitCData(uint32_t code, CData newval, int bits) {
+    *record(code, 1) = static_cast<char>(newval);
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedVbtBuffer::emitSData(uint32_t code, SData newval, int bits) {
+    char* const valp = record(code, 2);
+    valp[0] = static_cast<char>(newval);
+    valp[1] = static_cast<char>(newval >> 8);
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedVbtBuffer::emitIData(uint32_t code, IData newval, int bits) {
+    const int bytes = (bits + 7) / 8;
+    char* const valp = record(code, bytes);
+    for (int i = 0; i < bytes; ++i) valp[i] = static_cast<char>(newval >> (8 * i));
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedVbtBuffer::emitQData(uint32_t code, QData newval, int bits) {
+    const int bytes = (bits + 7) / 8;
+    char* const valp = record(code, bytes);
+    for (int i = 0; i < bytes; ++i) valp[i] = static_cast<char>(newval >> (8 * i));
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedVbtBuffer::emitWData(uint32_t code, const WData* newvalp, int bits) {
+    const int bytes = (bits + 7) / 8;
+    char* const valp = record(code, bytes);
+    for (int i = 0; i < bytes; ++i) {
+        valp[i] = static_cast<char>(newvalp[i / 4] >> (8 * (i % 4)));
+    }
+}
+
+VL_ATTR_ALWINLINE
+void VerilatedVbtBuffer::emitDouble(uint32_t code, double newval) {
+    uint64_t bitsval;
+    std::memcpy(&bitsval, &newval, sizeof(bitsval));
+    char* const valp = record(code, sizeof(bitsval));
+    for (int i = 0; i < 8; ++i) valp[i] = static_cast<char>(bitsval >> (8 * i));
+}
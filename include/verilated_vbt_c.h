@@ -0,0 +1,322 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//=============================================================================
+//
+// Code available from: https://verilator.org
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//=============================================================================
+///
+/// \file
+/// \brief Verilated tracing in VBT format header
+///
+/// User wrapper code should use this header when creating VBT traces.
+///
+/// VBT (Verilator Binary Trace) is a chunked, LZ4 compressed format with a
+/// time index, so a time window or a subset of signals can be extracted
+/// without reading the whole file. Use verilator_vbt2vcd to convert to VCD.
+///
+//=============================================================================
+
+#ifndef VERILATOR_VERILATED_VBT_C_H_
+#define VERILATOR_VERILATED_VBT_C_H_
+
+#include "verilated.h"
+#include "verilated_trace.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+class VerilatedVbtBuffer;
+
+//=============================================================================
+// VerilatedVbt
+// Base class to create a Verilator VBT dump
+// This is an internally used class - see VerilatedVbtC for what to call from applications
+
+class VerilatedVbt final : public VerilatedTrace<VerilatedVbt, VerilatedVbtBuffer> {
+public:
+    using Super = VerilatedTrace<VerilatedVbt, VerilatedVbtBuffer>;
+
+private:
+    friend VerilatedVbtBuffer;  // Give the buffer access to the private bits
+
+    struct ChunkIndex final {
+        uint64_t m_offset;  // File offset of chunk header
+        uint64_t m_startTime;  // First time point in chunk
+        uint64_t m_endTime;  // Last time point in chunk
+    };
+
+    //=========================================================================
+    // VBT-specific internals
+
+    int m_fd = -1;  // File descriptor we're writing to
+    bool m_isOpen = false;  // True indicates open file
+    std::string m_filename;  // Filename we're writing to (if open)
+    uint64_t m_fileOffset = 0;  // Bytes written to file
+    size_t m_chunkSize = 4 * 1024 * 1024;  // Uncompressed bytes to collect before a chunk
+
+    std::string m_decls;  // Scope and signal declaration records
+    std::vector<uint32_t> m_codeBytes;  // Value bytes per code
+    std::vector<uint32_t> m_stateOffsets;  // Offset of code in m_state, ~0 if not declared
+    std::vector<char> m_state;  // Value of each signal at the start of the current chunk
+
+    std::vector<char> m_raw;  // Value changes in the current chunk, in time order
+    size_t m_rawUsed = 0;  // Bytes used in m_raw
+    std::vector<uint64_t> m_times;  // Time points in the current chunk
+    std::vector<size_t> m_timeOffsets;  // Offset in m_raw where each time point starts
+    std::vector<ChunkIndex> m_index;  // Chunks written so far
+
+    // Scratch buffers for writeChunk
+    std::vector<uint32_t> m_cursors;  // Per code write position in m_payload
+    std::vector<char> m_payload;  // Uncompressed chunk payload
+    std::vector<char> m_compressed;  // Compressed chunk payload
+
+    // Prefixes to add to signal names/scope types
+    std::vector<std::pair<std::string, VerilatedTracePrefixType>> m_prefixStack{
+        {"", VerilatedTracePrefixType::SCOPE_MODULE}};
+
+    char* rawReserve(size_t size) {
+        if (VL_UNLIKELY(m_rawUsed + size > m_raw.size())) {
+            m_raw.resize(std::max(m_raw.size() * 2, m_rawUsed + size));
+        }
+        char* const resultp = m_raw.data() + m_rawUsed;
+        m_rawUsed += size;
+        return resultp;
+    }
+    void writeBytes(const void* datap, size_t size);
+    void writeChunk();
+    void writeIndex();
+    void declare(uint32_t code, const char* name, const char* wirep, int kind, bool array,
+                 int arraynum, bool bussed, int msb, int lsb);
+
+    // CONSTRUCTORS
+    VL_UNCOPYABLE(VerilatedVbt);
+
+protected:
+    //=========================================================================
+    // Implementation of VerilatedTrace interface
+
+    // Called when the trace moves forward to a new time point
+    void emitTimeChange(uint64_t timeui) override;
+
+    // Hooks called from VerilatedTrace
+    bool preFullDump() override { return isOpen(); }
+    bool preChangeDump() override { return isOpen(); }
+
+    // Trace buffer management
+    Buffer* getTraceBuffer(uint32_t fidx) override;
+    void commitTraceBuffer(Buffer*) override;
+
+    // Configure sub-class
+    void configure(const VerilatedTraceConfig&) override {}
+
+public:
+    //=========================================================================
+    // External interface to client code
+
+    // CONSTRUCTOR
+    explicit VerilatedVbt(void* filep = nullptr);
+    ~VerilatedVbt();
+
+    // ACCESSORS
+    // Set uncompressed size in bytes of value changes collected into each chunk
+    void chunkSize(size_t size) VL_MT_SAFE { m_chunkSize = size; }
+
+    // METHODS - All must be thread safe
+    // Open the file; call isOpen() to see if errors
+    void open(const char* filename) VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Close the file
+    void close() VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Flush any remaining data to this file
+    void flush() VL_MT_SAFE_EXCLUDES(m_mutex);
+    // Return if file is open
+    bool isOpen() const VL_MT_SAFE { return m_isOpen; }
+
+    //=========================================================================
+    // Internal interface to Verilator generated code
+
+    void pushPrefix(const char*, VerilatedTracePrefixType);
+    void popPrefix();
+
+    void declEvent(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                   VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                   bool array, int arraynum);
+    void declBit(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                 VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                 bool array, int arraynum);
+    void declBus(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                 VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                 bool array, int arraynum, int msb, int lsb);
+    void declQuad(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                  VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                  bool array, int arraynum, int msb, int lsb);
+    void declArray(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                   VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                   bool array, int arraynum, int msb, int lsb);
+    void declDouble(uint32_t code, uint32_t fidx, const char* name, int dtypenum,
+                    VerilatedTraceSigDirection, VerilatedTraceSigKind, VerilatedTraceSigType,
+                    bool array, int arraynum);
+};
+
+#ifndef DOXYGEN
+// Declare specialization here as it's used in VerilatedVbtC just below
+template <>
+void VerilatedVbt::Super::dump(uint64_t time);
+template <>
+void VerilatedVbt::Super::set_time_unit(const char* unitp);
+template <>
+void VerilatedVbt::Super::set_time_unit(const std::string& unit);
+template <>
+void VerilatedVbt::Super::set_time_resolution(const char* unitp);
+template <>
+void VerilatedVbt::Super::set_time_resolution(const std::string& unit);
+template <>
+void VerilatedVbt::Super::dumpvars(int level, const std::string& hier);
+template <>
+void VerilatedVbt::Super::dumpScope(const std::string& glob, bool include);
+template <>
+void VerilatedVbt::Super::dumpWindow(uint64_t start, uint64_t end);
+template <>
+void VerilatedVbt::Super::dumpTrigger(const std::string& signal);
+template <>
+void VerilatedVbt::Super::dumpOn(bool flag);
+template <>
+void VerilatedVbt::Super::dumpRecorder(uint64_t dumps);
+template <>
+void VerilatedVbt::Super::dumpRecorderWrite();
+template <>
+void VerilatedVbt::Super::dumpProfile(const std::string& filename);
+#endif
+
+//=============================================================================
+// VerilatedVbtBuffer
+
+class VerilatedVbtBuffer VL_NOT_FINAL {
+    // Give the trace file access to the private bits
+    friend VerilatedVbt;
+    friend VerilatedVbt::Super;
+    friend VerilatedVbt::Buffer;
+    friend VerilatedVbt::OffloadBuffer;
+
+    VerilatedVbt& m_owner;  // Trace file owning this buffer. Required by subclasses.
+
+    // Append a value change record for 'code' with 'size' value bytes, return value pointer
+    char* record(uint32_t code, size_t size);
+
+    // CONSTRUCTOR
+    explicit VerilatedVbtBuffer(VerilatedVbt& owner)
+        : m_owner{owner} {}
+    virtual ~VerilatedVbtBuffer() = default;
+
+    //=========================================================================
+    // Implementation of VerilatedTraceBuffer interface
+
+    // Implementations of duck-typed methods for VerilatedTraceBuffer. These are
+    // called from only one place (the full* methods), so always inline them.
+    VL_ATTR_ALWINLINE void emitEvent(uint32_t code);
+    VL_ATTR_ALWINLINE void emitBit(uint32_t code, CData newval);
+    VL_ATTR_ALWINLINE void emitCData(uint32_t code, CData newval, int bits);
+    VL_ATTR_ALWINLINE void emitSData(uint32_t code, SData newval, int bits);
+    VL_ATTR_ALWINLINE void emitIData(uint32_t code, IData newval, int bits);
+    VL_ATTR_ALWINLINE void emitQData(uint32_t code, QData newval, int bits);
+    VL_ATTR_ALWINLINE void emitWData(uint32_t code, const WData* newvalp, int bits);
+    VL_ATTR_ALWINLINE void emitDouble(uint32_t code, double newval);
+};
+
+//=============================================================================
+// VerilatedVbtC
+/// Create a VBT dump file in C standalone (no SystemC) simulations.
+/// Also derived for use in SystemC simulations.
+
+class VerilatedVbtC VL_NOT_FINAL : public VerilatedTraceBaseC {
+    VerilatedVbt m_sptrace;  // Trace file being created
+
+    // CONSTRUCTORS
+    VL_UNCOPYABLE(VerilatedVbtC);
+
+public:
+    /// Construct the dump. Optional argument is ignored.
+    explicit VerilatedVbtC(void* filep = nullptr)
+        : m_sptrace{filep} {}
+    /// Destruct, flush, and close the dump
+    virtual ~VerilatedVbtC() { close(); }
+
+    // METHODS - User called
+
+    /// Return if file is open
+    bool isOpen() const override VL_MT_SAFE { return m_sptrace.isOpen(); }
+    /// Open a new VBT file
+    virtual void open(const char* filename) VL_MT_SAFE { m_sptrace.open(filename); }
+    /// Close dump
+    void close() VL_MT_SAFE {
+        m_sptrace.close();
+        modelConnected(false);
+    }
+    /// Flush dump, this also ends the current chunk
+    void flush() VL_MT_SAFE { m_sptrace.flush(); }
+    /// Set uncompressed size in bytes of value changes collected into each
+    /// chunk. Smaller chunks allow finer grained seeking, but compress less.
+    void chunkSize(size_t size) VL_MT_SAFE { m_sptrace.chunkSize(size); }
+    /// Write one cycle of dump data
+    /// Call with the current context's time just after eval'ed,
+    /// e.g. ->dump(contextp->time())
+    void dump(uint64_t timeui) { m_sptrace.dump(timeui); }
+    /// Write one cycle of dump data - backward compatible and to reduce
+    /// conversion warnings.  It's better to use a uint64_t time instead.
+    void dump(double timestamp) { dump(static_cast<uint64_t>(timestamp)); }
+    void dump(uint32_t timestamp) { dump(static_cast<uint64_t>(timestamp)); }
+    void dump(int timestamp) { dump(static_cast<uint64_t>(timestamp)); }
+
+    // METHODS - Internal/backward compatible
+    // \protectedsection
+
+    // Set time units (s/ms, defaults to ns)
+    // Users should not need to call this, as for Verilated models, these
+    // propagate from the Verilated default timeunit
+    void set_time_unit(const char* unitp) VL_MT_SAFE { m_sptrace.set_time_unit(unitp); }
+    void set_time_unit(const std::string& unit) VL_MT_SAFE { m_sptrace.set_time_unit(unit); }
+    // Set time resolution (s/ms, defaults to ns)
+    // Users should not need to call this, as for Verilated models, these
+    // propagate from the Verilated default timeprecision
+    void set_time_resolution(const char* unitp) VL_MT_SAFE {
+        m_sptrace.set_time_resolution(unitp);
+    }
+    void set_time_resolution(const std::string& unit) VL_MT_SAFE {
+        m_sptrace.set_time_resolution(unit);
+    }
+    // Set variables to dump, using $dumpvars format
+    // If level = 0, dump everything and hier is then ignored
+    void dumpvars(int level, const std::string& hier) VL_MT_SAFE {
+        m_sptrace.dumpvars(level, hier);
+    }
+    // Trace (include = true) or do not trace (include = false) the signals
+    // under scopes matching the glob (with '*' and '?'). Call before open().
+    void dumpScope(const std::string& glob, bool include) VL_MT_SAFE {
+        m_sptrace.dumpScope(glob, include);
+    }
+    // Only dump at times within [start, end]; may be called multiple times
+    void dumpWindow(uint64_t start, uint64_t end) VL_MT_SAFE { m_sptrace.dumpWindow(start, end); }
+    // Only dump when the given hierarchical signal is non-zero
+    void dumpTrigger(const std::string& signal) VL_MT_SAFE { m_sptrace.dumpTrigger(signal); }
+    // Enable (default) or disable dumps, e.g. from an external trigger
+    void dumpOn(bool flag) VL_MT_SAFE { m_sptrace.dumpOn(flag); }
+    // Keep only the last dumps in memory, and write them on an error or
+    // dumpRecorderWrite(); see VerilatedTrace::dumpRecorder
+    void dumpRecorder(uint64_t dumps) VL_MT_SAFE { m_sptrace.dumpRecorder(dumps); }
+    // Write the dumps kept by dumpRecorder() to the file
+    void dumpRecorderWrite() VL_MT_SAFE { m_sptrace.dumpRecorderWrite(); }
+    // Write a report of the trace cost of each signal and scope to the
+    // file on close; see VerilatedTrace::dumpProfile
+    void dumpProfile(const std::string& filename) VL_MT_SAFE { m_sptrace.dumpProfile(filename); }
+
+    // Internal class access
+    VerilatedVbt* spTrace() { return &m_sptrace; }
+};
+
+#endif  // guard
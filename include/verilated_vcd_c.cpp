@@ -36,6 +36,10 @@
 #else
 # include <unistd.h>
 #endif
+#ifndef _WIN32
+# include <sys/mman.h>
+# define VL_VCD_MMAP
+#endif
 
 #ifndef O_LARGEFILE  // WIN32 headers omit this
 # define O_LARGEFILE 0
@@ -87,6 +91,86 @@ ssize_t VerilatedVcdFile::write(const char* bufp, ssize_t len) VL_MT_UNSAFE {
     return ::write(m_fd, bufp, len);
 }
 
+//=============================================================================
+// VerilatedVcdMmapFile
+
+bool VerilatedVcdMmapFile::open(const std::string& name) VL_MT_UNSAFE {
+    // Mapping for writing needs the file open for reading too
+    m_fd = ::open(name.c_str(), O_CREAT | O_RDWR | O_TRUNC | O_LARGEFILE | O_CLOEXEC, 0666);
+    m_fileSize = 0;
+    m_dataSize = 0;
+    return m_fd >= 0;
+}
+
+void VerilatedVcdMmapFile::close() VL_MT_UNSAFE {
+    unmap(m_dataSize);
+#ifdef VL_VCD_MMAP
+    // Remove the preallocated space after the data
+    if (m_fileSize > m_dataSize) {
+        const int err VL_ATTR_UNUSED = ::ftruncate(m_fd, m_dataSize);  // Like close, ignore errors
+    }
+#endif
+    ::close(m_fd);
+    m_fd = -1;
+}
+
+ssize_t VerilatedVcdMmapFile::write(const char* bufp, ssize_t len) VL_MT_UNSAFE {
+    // Used only if mapping failed, the file may have preallocated space after the data
+#ifdef VL_VCD_MMAP
+    const ssize_t got = ::pwrite(m_fd, bufp, len, m_dataSize);
+#else
+    const ssize_t got = ::write(m_fd, bufp, len);
+#endif
+    if (got > 0) m_dataSize += got;
+    return got;
+}
+
+char* VerilatedVcdMmapFile::map(uint64_t offset, size_t& size) VL_MT_UNSAFE {
+#ifdef VL_VCD_MMAP
+    unmap(std::max(m_dataSize, offset));
+    // Mappings must start on a page boundary
+    const uint64_t pageSize = ::sysconf(_SC_PAGESIZE);
+    const uint64_t mapOffset = offset - offset % pageSize;
+    const uint64_t chunkSize = std::max<uint64_t>(m_chunkSize - m_chunkSize % pageSize, pageSize);
+    const uint64_t mapSize = ((offset - mapOffset + size + chunkSize - 1) / chunkSize) * chunkSize;
+    if (mapOffset + mapSize > m_fileSize) {
+        // Allocate the blocks now, as running out of space when writing to
+        // the mapping would be a SIGBUS
+#ifdef __linux__
+        if (::posix_fallocate(m_fd, m_fileSize, mapOffset + mapSize - m_fileSize)) return nullptr;
+#else
+        if (::ftruncate(m_fd, mapOffset + mapSize)) return nullptr;
+#endif
+        m_fileSize = mapOffset + mapSize;
+    }
+    void* const mapp
+        = ::mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, mapOffset);
+    if (VL_UNCOVERABLE(mapp == MAP_FAILED)) return nullptr;  // LCOV_EXCL_LINE
+    m_mapp = static_cast<char*>(mapp);
+    m_mapSize = mapSize;
+    m_mapOffset = mapOffset;
+    size = mapSize - (offset - mapOffset);
+    return m_mapp + (offset - mapOffset);
+#else
+    return nullptr;
+#endif
+}
+
+void VerilatedVcdMmapFile::unmap(uint64_t end) VL_MT_UNSAFE {
+    m_dataSize = end;
+#ifdef VL_VCD_MMAP
+    if (!m_mapp) return;
+    ::munmap(m_mapp, m_mapSize);
+#ifdef __linux__
+    // Start writing back the pages we are done with, without waiting for it,
+    // so the dirty pages do not pile up until the kernel throttles us
+    ::sync_file_range(m_fd, m_mapOffset, m_mapSize, SYNC_FILE_RANGE_WRITE);
+#endif
+    m_mapp = nullptr;
+    m_mapSize = 0;
+#endif
+}
+
 //=============================================================================
 //=============================================================================
 //=============================================================================
@@ -178,6 +262,9 @@ void VerilatedVcd::openNextImp(bool incFilename) {
         }
     }
     m_isOpen = true;
+    // Write directly into the file if it can be mapped
+    m_wrMapOffset = 0;
+    bufferMap();
     constDump(true);  // First dump must contain the const signals
     fullDump(true);  // First dump must be full
     m_wroteBytes = 0;
@@ -220,6 +307,7 @@ void VerilatedVcd::closePrev() {
 
     Super::flushBase();
     bufferFlush();
+    if (m_wrMapEndp) bufferUnmap();
     m_isOpen = false;
     m_filep->close();
 }
@@ -231,6 +319,7 @@ void VerilatedVcd::closeErr() {
     if (!isOpen()) return;
 
     // No buffer flush, just fclose
+    if (m_wrMapEndp) bufferUnmap();
     m_isOpen = false;
     m_filep->close();  // May get error, just ignore it
 }
@@ -263,8 +352,15 @@ void VerilatedVcd::bufferResize(size_t minsize) {
     // minsize is size of largest write.  We buffer at least 8 times as much data,
     // writing when we are 3/4 full (with thus 2*minsize remaining free)
     if (VL_UNLIKELY(minsize > m_wrChunkSize)) {
-        const char* oldbufp = m_wrBufp;
         m_wrChunkSize = vlstd::roundUpToMultipleOf<1024>(minsize * 2);
+        if (m_wrMapEndp) {
+            // The heap buffer is not in use, the mapping may need extending
+            VL_DO_CLEAR(delete[] m_wrHeapBufp, m_wrHeapBufp = new char[m_wrChunkSize * 8]);
+            if (static_cast<size_t>(m_wrMapEndp - m_wrBufp) < m_wrChunkSize * 8) bufferMap();
+            m_wrFlushp = m_wrBufp + m_wrChunkSize * 6;
+            return;
+        }
+        const char* oldbufp = m_wrBufp;
         m_wrBufp = new char[m_wrChunkSize * 8];
         std::memcpy(m_wrBufp, oldbufp, m_writep - oldbufp);
         m_writep = m_wrBufp + (m_writep - oldbufp);
@@ -284,6 +380,18 @@ void VerilatedVcd::bufferFlush() VL_MT_UNSAFE_ONE {
     // When it gets nearly full we dump it using this routine which calls write()
     // This is much faster than using buffered I/O
     if (VL_UNLIKELY(!m_isOpen)) return;
+    if (m_wrMapEndp) {
+        // The data is already in the file, just move the buffer past it
+        m_wroteBytes += m_writep - m_wrBufp;
+        m_wrMapOffset += m_writep - m_wrBufp;
+        m_wrBufp = m_writep;
+        m_wrTimeBeginp = nullptr;
+        m_wrTimeEndp = nullptr;
+        // Map the next part of the file when a whole buffer no longer fits
+        if (static_cast<size_t>(m_wrMapEndp - m_wrBufp) < m_wrChunkSize * 8) bufferMap();
+        m_wrFlushp = m_wrBufp + m_wrChunkSize * 6;
+        return;
+    }
     const char* wp = m_wrBufp;
     while (true) {
         const ssize_t remaining = (m_writep - wp);
@@ -312,6 +420,44 @@ void VerilatedVcd::bufferFlush() VL_MT_UNSAFE_ONE {
     m_wrTimeEndp = nullptr;
 }
 
+void VerilatedVcd::bufferMap() {
+    // Map the file from the start of the output buffer, keeping its contents
+    const size_t used = m_writep - m_wrBufp;
+    size_t size = m_wrChunkSize * 8;
+    char* const mapp = m_filep->map(m_wrMapOffset, size);
+    if (VL_UNLIKELY(!mapp)) {
+        // Not supported, or out of space; continue with write() calls
+        if (m_wrMapEndp) bufferUnmap();
+        return;
+    }
+    if (!m_wrMapEndp) {
+        // Switching from the heap buffer
+        std::memcpy(mapp, m_wrBufp, used);
+        m_wrHeapBufp = m_wrBufp;
+    }
+    if (m_wrTimeBeginp) {
+        m_wrTimeBeginp = mapp + (m_wrTimeBeginp - m_wrBufp);
+        m_wrTimeEndp = mapp + (m_wrTimeEndp - m_wrBufp);
+    }
+    m_wrBufp = mapp;
+    m_writep = mapp + used;
+    m_wrMapEndp = mapp + size;
+    m_wrFlushp = m_wrBufp + m_wrChunkSize * 6;
+}
+
+void VerilatedVcd::bufferUnmap() {
+    // Go back to the heap buffer. Data in the mapping is already in the file.
+    m_wroteBytes += m_writep - m_wrBufp;
+    m_filep->unmap(m_wrMapOffset + (m_writep - m_wrBufp));
+    m_wrBufp = m_wrHeapBufp;
+    m_wrHeapBufp = nullptr;
+    m_wrMapEndp = nullptr;
+    m_writep = m_wrBufp;
+    m_wrFlushp = m_wrBufp + m_wrChunkSize * 6;
+    m_wrTimeBeginp = nullptr;
+    m_wrTimeEndp = nullptr;
+}
+
 //=============================================================================
 // Definitions
 
@@ -599,6 +745,7 @@ void VerilatedVcdBuffer::finishLine(uint32_t code, char* writep) {
             m_owner.m_writep = m_writep;
             m_owner.bufferFlush();
             m_writep = m_owner.m_writep;
+            m_wrFlushp = m_owner.m_wrFlushp;
         }
     }
 }
@@ -61,6 +61,12 @@ private:
     size_t m_maxSignalBytes = 0;  // Upper bound on number of bytes a single signal can generate
     uint64_t m_wroteBytes = 0;  // Number of bytes written to this file
 
+    // When the file supports it, m_wrBufp points into a mapping of the file,
+    // and flushing the output buffer only moves the buffer along the file
+    char* m_wrHeapBufp = nullptr;  // Output buffer on the heap, while mapped
+    char* m_wrMapEndp = nullptr;  // End of file mapping, nullptr if not mapped
+    uint64_t m_wrMapOffset = 0;  // File offset of m_wrBufp, if mapped
+
     std::vector<char> m_suffixes;  // VCD line end string codes + metadata
 
     // Prefixes to add to signal names/scope types
@@ -73,6 +79,8 @@ private:
 
     void bufferResize(size_t minsize);
     void bufferFlush() VL_MT_UNSAFE_ONE;
+    void bufferMap();
+    void bufferUnmap();
     void bufferCheck() {
         // Flush the write buffer if there's not enough space left for new information
         // We only call this once per vector, so we need enough slop for a very wide "b###" line
@@ -171,6 +179,20 @@ template <>
 void VerilatedVcd::Super::set_time_resolution(const std::string& unit);
 template <>
 void VerilatedVcd::Super::dumpvars(int level, const std::string& hier);
+template <>
+void VerilatedVcd::Super::dumpScope(const std::string& glob, bool include);
+template <>
+void VerilatedVcd::Super::dumpWindow(uint64_t start, uint64_t end);
+template <>
+void VerilatedVcd::Super::dumpTrigger(const std::string& signal);
+template <>
+void VerilatedVcd::Super::dumpOn(bool flag);
+template <>
+void VerilatedVcd::Super::dumpRecorder(uint64_t dumps);
+template <>
+void VerilatedVcd::Super::dumpRecorderWrite();
+template <>
+void VerilatedVcd::Super::dumpProfile(const std::string& filename);
 #endif  // DOXYGEN
 
 //=============================================================================
@@ -188,7 +210,7 @@ class VerilatedVcdBuffer VL_NOT_FINAL {
     // Write pointer into output buffer (in parallel mode, this is set up in 'getTraceBuffer')
     char* m_writep = m_owner.parallel() ? nullptr : m_owner.m_writep;
     // Output buffer flush trigger location (only used when not parallel)
-    char* const m_wrFlushp = m_owner.parallel() ? nullptr : m_owner.m_wrFlushp;
+    char* m_wrFlushp = m_owner.parallel() ? nullptr : m_owner.m_wrFlushp;
 
     // VCD line end string codes + metadata
     const char* const m_suffixes = m_owner.m_suffixes.data();
@@ -246,6 +268,45 @@ public:
     virtual void close() VL_MT_UNSAFE;
     /// Write data to file (if it is open)
     virtual ssize_t write(const char* bufp, ssize_t len) VL_MT_UNSAFE;
+    /// Map the file for writing from 'offset' onwards, for at least 'size'
+    /// bytes, replacing any previous mapping. Returns the address of 'offset',
+    /// and sets 'size' to the mapped size from there. Returns nullptr if
+    /// mapping is not supported, in which case write() is used.
+    virtual char* map(uint64_t, size_t&) VL_MT_UNSAFE { return nullptr; }
+    /// Remove the mapping, the file data ends at the given offset
+    virtual void unmap(uint64_t) VL_MT_UNSAFE {}
+};
+
+//=============================================================================
+// VerilatedVcdMmapFile
+/// VCD file written through a shared memory mapping of the file. The file is
+/// grown in large preallocated chunks, and the trace writes directly into
+/// the mapping, so the kernel writes the pages back in the background,
+/// instead of the simulation waiting on write() calls. The file is truncated
+/// to the written size when closed. Not supported on Windows, where this
+/// falls back to write() calls.
+
+class VerilatedVcdMmapFile VL_NOT_FINAL : public VerilatedVcdFile {
+private:
+    int m_fd = -1;  // File descriptor we're writing to
+    const size_t m_chunkSize;  // Size to grow file and mapping by
+    uint64_t m_fileSize = 0;  // Allocated size of the file
+    uint64_t m_dataSize = 0;  // Size of data written to the file
+    char* m_mapp = nullptr;  // Current mapping
+    size_t m_mapSize = 0;  // Size of current mapping
+    uint64_t m_mapOffset = 0;  // File offset of current mapping
+public:
+    // METHODS
+    /// Construct a (as yet) closed file, growing in steps of 'chunkSize' bytes
+    explicit VerilatedVcdMmapFile(size_t chunkSize = 64 * 1024 * 1024)
+        : m_chunkSize{chunkSize} {}
+    /// Close and destruct
+    ~VerilatedVcdMmapFile() override = default;
+    bool open(const std::string& name) override VL_MT_UNSAFE;
+    void close() override VL_MT_UNSAFE;
+    ssize_t write(const char* bufp, ssize_t len) override VL_MT_UNSAFE;
+    char* map(uint64_t offset, size_t& size) override VL_MT_UNSAFE;
+    void unmap(uint64_t end) override VL_MT_UNSAFE;
 };
 
 //=============================================================================
@@ -321,6 +382,25 @@ public:
     void dumpvars(int level, const std::string& hier) VL_MT_SAFE {
         m_sptrace.dumpvars(level, hier);
     }
+    // Trace (include = true) or do not trace (include = false) the signals
+    // under scopes matching the glob (with '*' and '?'). Call before open().
+    void dumpScope(const std::string& glob, bool include) VL_MT_SAFE {
+        m_sptrace.dumpScope(glob, include);
+    }
+    // Only dump at times within [start, end]; may be called multiple times
+    void dumpWindow(uint64_t start, uint64_t end) VL_MT_SAFE { m_sptrace.dumpWindow(start, end); }
+    // Only dump when the given hierarchical signal is non-zero
+    void dumpTrigger(const std::string& signal) VL_MT_SAFE { m_sptrace.dumpTrigger(signal); }
+    // Enable (default) or disable dumps, e.g. from an external trigger
+    void dumpOn(bool flag) VL_MT_SAFE { m_sptrace.dumpOn(flag); }
+    // Keep only the last dumps in memory, and write them on an error or
+    // dumpRecorderWrite(); see VerilatedTrace::dumpRecorder
+    void dumpRecorder(uint64_t dumps) VL_MT_SAFE { m_sptrace.dumpRecorder(dumps); }
+    // Write the dumps kept by dumpRecorder() to the file
+    void dumpRecorderWrite() VL_MT_SAFE { m_sptrace.dumpRecorderWrite(); }
+    // Write a report of the trace cost of each signal and scope to the
+    // file on close; see VerilatedTrace::dumpProfile
+    void dumpProfile(const std::string& filename) VL_MT_SAFE { m_sptrace.dumpProfile(filename); }
 
     // Internal class access
     VerilatedVcd* spTrace() { return &m_sptrace; }
@@ -39,6 +39,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -377,6 +378,7 @@ public:
         if (varp) {
             m_mask.u32 = varp->m_mask.u32;
             m_entSize = varp->m_entSize;
+            m_bitOffset = varp->m_bitOffset;
             m_varDatap = varp->m_varDatap;
             m_index = varp->m_index;
             // Not copying m_prevDatap, must be nullptr
@@ -435,6 +437,16 @@ public:
     }
     void* prevDatap() const { return m_prevDatap; }
     void* varDatap() const override { return m_varDatap; }
+    // Value change flag of the variable (--vpi-dirty), nullptr = none
+    CData* dirtyp() const {
+        CData* const flagsp = scopep()->symsp()->__Vm_vpiDirtyp;
+        if (!flagsp || varp()->dirtyIndex() < 0) return nullptr;
+        return flagsp + varp()->dirtyIndex();
+    }
+    // Flag a write other than by the model, so value change callbacks see it
+    void markDirty() const {
+        if (CData* const flagp = dirtyp()) *flagp = 1;
+    }
     void createPrevDatap() {
         if (VL_UNLIKELY(!m_prevDatap)) {
             m_prevDatap = new uint8_t[entSize()];
@@ -695,6 +707,43 @@ public:
     }
 };
 
+class VerilatedVpioGroup final : public VerilatedVpio {
+    // A group of variables read and written together by VerilatedVpi::groupGet/groupPut
+public:
+    struct Member final {
+        VerilatedVpioVar* m_vop;  // Owned copy of the member's handle
+        uint32_t m_words;  // 32-bit words of the member in the caller's buffer
+        bool m_whole;  // Entire variable element at bit 0, can be copied directly
+    };
+
+private:
+    std::vector<Member> m_members;  // Members, in buffer order
+    uint32_t m_words = 0;  // Total 32-bit words in the caller's buffer
+    bool m_writable = true;  // All members are public_rw
+
+public:
+    VerilatedVpioGroup() = default;
+    ~VerilatedVpioGroup() override {
+        for (Member& member : m_members) VL_DO_DANGLING(delete member.m_vop, member.m_vop);
+    }
+    // cppcheck-suppress duplInheritedMember
+    static VerilatedVpioGroup* castp(vpiHandle h) {
+        return dynamic_cast<VerilatedVpioGroup*>(reinterpret_cast<VerilatedVpio*>(h));
+    }
+    void add(const VerilatedVpioVar* vop) {
+        const uint32_t bits = vop->bitSize();
+        const bool whole = vop->bitOffset() == 0
+                           && bits == static_cast<uint32_t>(vop->varp()->entBits());
+        m_members.push_back({new VerilatedVpioVar{vop}, VL_WORDS_I(bits), whole});
+        m_words += VL_WORDS_I(bits);
+        if (!vop->varp()->isPublicRW()) m_writable = false;
+    }
+    const std::vector<Member>& members() const { return m_members; }
+    uint32_t words() const { return m_words; }
+    bool writable() const { return m_writable; }
+    uint32_t size() const override { return m_members.size(); }
+};
+
 //======================================================================
 
 using VerilatedPliCb = PLI_INT32 (*)(struct t_cb_data*);
@@ -885,6 +934,15 @@ class VerilatedVpiImp final {
     enum { CB_ENUM_MAX_VALUE = cbAtEndOfSimTime + 1 };  // Maximum callback reason
     using VpioCbList = std::list<VerilatedVpiCbHolder>;
     using VpioFutureCbs = std::map<std::pair<QData, uint64_t>, VerilatedVpiCbHolder>;
+    // cbValueChange callbacks of a model's variables with value change flags
+    struct VpioDirtyCbs final {
+        CData* const m_flagsp;  // The model's value change flags
+        const uint32_t m_size;  // Number of flags
+        std::unordered_map<uint32_t, VpioCbList> m_cbs;  // Callbacks by flag index
+        VpioDirtyCbs(CData* flagsp, uint32_t size)
+            : m_flagsp{flagsp}
+            , m_size{size} {}
+    };
 
     // All only medium-speed, so use singleton function
     // Callbacks that are past or at current timestamp
@@ -892,6 +950,7 @@ class VerilatedVpiImp final {
     VpioCbList m_cbCallList;  // List of callbacks currently being called by callCbs
     VpioFutureCbs m_futureCbs;  // Time based callbacks for future timestamps
     VpioFutureCbs m_nextCbs;  // cbNextSimTime callbacks
+    std::list<VpioDirtyCbs> m_dirtyCbs;  // cbValueChange callbacks using value change flags
     std::list<VerilatedVpiPutHolder> m_inertialPuts;  // Pending vpi puts due to vpiInertialDelay
     VerilatedVpiError* m_errorInfop = nullptr;  // Container for vpi error info
     VerilatedAssertOneThread m_assertOne;  // Assert only called from single thread
@@ -915,9 +974,25 @@ public:
         VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: vpi_register_cb reason=%d id=%" PRId64 " obj=%p\n",
                                     cb_data_p->reason, id, cb_data_p->obj););
         VerilatedVpioVar* varop = nullptr;
-        if (cb_data_p->reason == cbValueChange) varop = VerilatedVpioVar::castp(cb_data_p->obj);
+        if (cb_data_p->reason == cbValueChange) {
+            varop = VerilatedVpioVar::castp(cb_data_p->obj);
+            // Callbacks on variables with a value change flag are only checked when flagged
+            if (varop && varop->dirtyp()) {
+                dirtyCbs(varop).m_cbs[varop->varp()->dirtyIndex()].emplace_back(id, cb_data_p,
+                                                                                 varop);
+                return;
+            }
+        }
         s().m_cbCurrentLists[cb_data_p->reason].emplace_back(id, cb_data_p, varop);
     }
+    static VpioDirtyCbs& dirtyCbs(const VerilatedVpioVar* varop) {
+        const VerilatedSyms* const symsp = varop->scopep()->symsp();
+        for (VpioDirtyCbs& dirty : s().m_dirtyCbs) {
+            if (dirty.m_flagsp == symsp->__Vm_vpiDirtyp) return dirty;
+        }
+        s().m_dirtyCbs.emplace_back(symsp->__Vm_vpiDirtyp, symsp->__Vm_vpiDirtySize);
+        return s().m_dirtyCbs.back();
+    }
     static void cbFutureAdd(uint64_t id, const s_cb_data* cb_data_p, QData time) {
         // The passed cb_data_p was property of the user, so need to recreate
         VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: vpi_register_cb reason=%d id=%" PRId64 " time=%" PRIu64
@@ -951,6 +1026,18 @@ public:
                 return;  // Once found, it won't also be in m_futureCbs or m_nextCbs
             }
         }
+        if (reason == cbValueChange) {  // Remove from value change flag lists
+            for (VpioDirtyCbs& dirty : s().m_dirtyCbs) {
+                for (auto& it : dirty.m_cbs) {
+                    for (auto& ir : it.second) {
+                        if (ir.id() == id) {
+                            ir.invalidate();
+                            return;
+                        }
+                    }
+                }
+            }
+        }
         {  // Remove from cbFuture queue
             const auto it = s().m_futureCbs.find(std::make_pair(time, id));
             if (it != s().m_futureCbs.end()) {
@@ -1000,6 +1087,11 @@ public:
         return ~0ULL;  // maxquad
     }
     static bool hasCbs(const uint32_t reason) VL_MT_UNSAFE_ONE {
+        if (reason == cbValueChange) {
+            for (const VpioDirtyCbs& dirty : s().m_dirtyCbs) {
+                if (!dirty.m_cbs.empty()) return true;
+            }
+        }
         return !s().m_cbCurrentLists[reason].empty();
     }
     static bool callCbs(const uint32_t reason) VL_MT_UNSAFE_ONE {
@@ -1025,7 +1117,33 @@ public:
     }
     static bool callValueCbs() VL_MT_UNSAFE_ONE {
         assertOneCheck();
-        VpioCbList& cbObjList = s().m_cbCurrentLists[cbValueChange];
+        bool called = callValueCbList(s().m_cbCurrentLists[cbValueChange]);
+        for (VpioDirtyCbs& dirty : s().m_dirtyCbs) {
+            if (dirty.m_cbs.empty()) continue;
+            // Only variables written since the last call may have changed. Scan
+            // the flags a word at a time, as most are expected to be clear.
+            for (uint32_t base = 0; base < dirty.m_size; base += sizeof(uint64_t)) {
+                if (base + sizeof(uint64_t) <= dirty.m_size) {
+                    uint64_t word;
+                    std::memcpy(&word, dirty.m_flagsp + base, sizeof(word));
+                    if (VL_LIKELY(!word)) continue;
+                }
+                const uint32_t end = std::min<uint32_t>(base + sizeof(uint64_t), dirty.m_size);
+                for (uint32_t index = base; index < end; ++index) {
+                    if (!dirty.m_flagsp[index]) continue;
+                    dirty.m_flagsp[index] = 0;
+                    const auto it = dirty.m_cbs.find(index);
+                    if (it == dirty.m_cbs.end()) continue;
+                    // Callbacks may add callbacks, so must not keep the iterator
+                    VpioCbList& cbObjList = it->second;
+                    if (callValueCbList(cbObjList)) called = true;
+                    if (cbObjList.empty()) dirty.m_cbs.erase(index);
+                }
+            }
+        }
+        return called;
+    }
+    static bool callValueCbList(VpioCbList& cbObjList) VL_MT_UNSAFE_ONE {
         bool called = false;
         std::set<VerilatedVpioVar*> update;  // set of objects to update after callbacks
         if (cbObjList.empty()) return called;
@@ -1201,6 +1319,18 @@ void VerilatedVpiImp::dumpCbs() VL_MT_UNSAFE_ONE {
             }
         }
     }
+    for (auto& dirty : s().m_dirtyCbs) {
+        for (auto& it : dirty.m_cbs) {
+            for (auto& ho : it.second) {
+                if (VL_UNLIKELY(!ho.invalid())) {
+                    VL_DBG_MSGF("- vpi:   flag=%u reason=%d=%s  id=%" PRId64 "\n", it.first,
+                                cbValueChange,
+                                VerilatedVpiError::strFromVpiCallbackReason(cbValueChange),
+                                ho.id());
+                }
+            }
+        }
+    }
     for (auto& ifuture : s().m_nextCbs) {
         const QData time = ifuture.first.first;
         VerilatedVpiCbHolder& ho = ifuture.second;
@@ -2775,6 +2905,7 @@ vpiHandle vpi_put_value(vpiHandle object, p_vpi_value valuep, p_vpi_time /*time_
             return object;
         }
         VerilatedVpiImp::evalNeeded(true);
+        vop->markDirty();
         const int varBits = vop->bitSize();
         if (valuep->format == vpiVectorVal) {
             if (VL_UNLIKELY(!valuep->value.vector)) return nullptr;
@@ -2910,6 +3041,129 @@ vpiHandle vpi_put_value(vpiHandle object, p_vpi_value valuep, p_vpi_time /*time_
     return nullptr;
 }
 
+//======================================================================
+// VerilatedVpi bulk access
+
+vpiHandle VerilatedVpi::groupCreate(const vpiHandle* handlesp, PLI_INT32 count) VL_MT_UNSAFE_ONE {
+    VL_DEBUG_IF_PLI(VL_DBG_MSGF("- vpi: groupCreate %p %d\n", handlesp, count););
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    if (VL_UNLIKELY(!handlesp || count < 0)) return nullptr;
+    VerilatedVpioGroup* const groupp = new VerilatedVpioGroup;
+    for (PLI_INT32 i = 0; i < count; ++i) {
+        const VerilatedVpioVar* const vop = VerilatedVpioVar::castp(handlesp[i]);
+        if (VL_UNLIKELY(!vop)) {
+            VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Unsupported vpiHandle (%p)", __func__,
+                          handlesp[i]);
+            VL_DO_DANGLING(delete groupp, groupp);
+            return nullptr;
+        }
+        switch (vop->varp()->vltype()) {
+        case VLVT_UINT8:
+        case VLVT_UINT16:
+        case VLVT_UINT32:
+        case VLVT_UINT64:
+        case VLVT_WDATA:
+            if (!vop->isIndexedDimUnpacked()) break;
+            // FALLTHRU
+        default:
+            VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Unsupported type (%s), only vectors: %s",
+                          __func__, VerilatedVpiError::strFromVpiObjType(vop->type()),
+                          vop->fullname());
+            VL_DO_DANGLING(delete groupp, groupp);
+            return nullptr;
+        }
+        groupp->add(vop);
+    }
+    return groupp->castVpiHandle();
+}
+
+PLI_INT32 VerilatedVpi::groupWords(vpiHandle group) VL_MT_UNSAFE_ONE {
+    const VerilatedVpioGroup* const groupp = VerilatedVpioGroup::castp(group);
+    if (VL_UNLIKELY(!groupp)) return 0;
+    return groupp->words();
+}
+
+void VerilatedVpi::groupGet(vpiHandle group, PLI_UINT32* bufp) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    const VerilatedVpioGroup* const groupp = VerilatedVpioGroup::castp(group);
+    if (VL_UNLIKELY(!groupp || !bufp)) {
+        VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Unsupported vpiHandle (%p)", __func__, group);
+        return;
+    }
+    for (const VerilatedVpioGroup::Member& member : groupp->members()) {
+        const VerilatedVpioVar* const vop = member.m_vop;
+        if (VL_LIKELY(member.m_whole)) {
+            // Model data is kept clean above the width, so no masking needed
+            switch (vop->varp()->vltype()) {
+            case VLVT_UINT8: bufp[0] = *vop->varCDatap(); break;
+            case VLVT_UINT16: bufp[0] = *vop->varSDatap(); break;
+            case VLVT_UINT32: bufp[0] = *vop->varIDatap(); break;
+            case VLVT_UINT64: {
+                const QData value = *vop->varQDatap();
+                bufp[0] = static_cast<PLI_UINT32>(value);
+                if (member.m_words > 1) bufp[1] = static_cast<PLI_UINT32>(value >> 32);
+                break;
+            }
+            default:  // VLVT_WDATA
+                std::memcpy(bufp, vop->varEDatap(), member.m_words * sizeof(EData));
+                break;
+            }
+        } else {
+            for (uint32_t i = 0; i < member.m_words; ++i)
+                bufp[i] = static_cast<PLI_UINT32>(vl_vpi_get_word(vop, 32, i * 32));
+        }
+        bufp += member.m_words;
+    }
+}
+
+void VerilatedVpi::groupPut(vpiHandle group, const PLI_UINT32* bufp) VL_MT_UNSAFE_ONE {
+    VerilatedVpiImp::assertOneCheck();
+    VL_VPI_ERROR_RESET_();
+    const VerilatedVpioGroup* const groupp = VerilatedVpioGroup::castp(group);
+    if (VL_UNLIKELY(!groupp || !bufp)) {
+        VL_VPI_ERROR_(__FILE__, __LINE__, "%s: Unsupported vpiHandle (%p)", __func__, group);
+        return;
+    }
+    if (VL_UNLIKELY(!groupp->writable())) {
+        VL_VPI_ERROR_(__FILE__, __LINE__,
+                      "%s: group contains a signal marked read-only,"
+                      " use public_flat_rw instead",
+                      __func__);
+        return;
+    }
+    VerilatedVpiImp::evalNeeded(true);
+    for (const VerilatedVpioGroup::Member& member : groupp->members()) {
+        const VerilatedVpioVar* const vop = member.m_vop;
+        vop->markDirty();
+        if (VL_LIKELY(member.m_whole)) {
+            const int bits = vop->bitSize();
+            switch (vop->varp()->vltype()) {
+            case VLVT_UINT8: *vop->varCDatap() = bufp[0] & VL_MASK_I(bits); break;
+            case VLVT_UINT16: *vop->varSDatap() = bufp[0] & VL_MASK_I(bits); break;
+            case VLVT_UINT32: *vop->varIDatap() = bufp[0] & VL_MASK_I(bits); break;
+            case VLVT_UINT64: {
+                QData value = bufp[0];
+                if (member.m_words > 1) value |= static_cast<QData>(bufp[1]) << 32;
+                *vop->varQDatap() = value & VL_MASK_Q(bits);
+                break;
+            }
+            default: {  // VLVT_WDATA
+                EData* const datap = vop->varEDatap();
+                std::memcpy(datap, bufp, member.m_words * sizeof(EData));
+                datap[member.m_words - 1] &= VL_MASK_E(bits);
+                break;
+            }
+            }
+        } else {
+            for (uint32_t i = 0; i < member.m_words; ++i)
+                vl_vpi_put_word(vop, bufp[i], 32, i * 32);
+        }
+        bufp += member.m_words;
+    }
+}
+
 bool vl_check_array_format(const VerilatedVar* varp, const p_vpi_arrayvalue arrayvalue_p,
                            const char* fullname) {
     if (arrayvalue_p->format == vpiVectorVal) {
@@ -65,6 +65,22 @@ public:
     /// Perform inertially delayed puts
     static void doInertialPuts() VL_MT_UNSAFE_ONE;
 
+    /// Create a group of variable handles, for reading or writing all of
+    /// their values with a single groupGet or groupPut call.  Handles must
+    /// be integral variables, or elements or bit selects of them.  Each
+    /// member's value is VL_WORDS_I(bits) consecutive 32-bit words of the
+    /// caller's buffer, least significant word first as in vpiVectorVal
+    /// avals.  The handles may be released after the call.  Returns
+    /// nullptr on error; release the group with vpi_release_handle.
+    static vpiHandle groupCreate(const vpiHandle* handlesp, PLI_INT32 count) VL_MT_UNSAFE_ONE;
+    /// Return number of 32-bit words of a group's buffer
+    static PLI_INT32 groupWords(vpiHandle group) VL_MT_UNSAFE_ONE;
+    /// Read the values of all group members into bufp
+    static void groupGet(vpiHandle group, PLI_UINT32* bufp) VL_MT_UNSAFE_ONE;
+    /// Write the values of all group members from bufp, as if by
+    /// vpi_put_value with vpiVectorVal and vpiNoDelay on each member
+    static void groupPut(vpiHandle group, const PLI_UINT32* bufp) VL_MT_UNSAFE_ONE;
+
     // Self test, for internal use only
     static void selfTest() VL_MT_UNSAFE_ONE;
 };
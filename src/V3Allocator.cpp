@@ -0,0 +1,172 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Size class pool allocator for AST and graph nodes
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// Each size class (a multiple of GRANULE bytes) owns a list of slabs, and
+// a free list threaded through the unused objects in those slabs. A new
+// slab is carved entirely onto the free list when it is allocated.
+//
+// trim() sorts each free list by address, counts the free objects in each
+// slab, releases slabs where all objects are free, and rebuilds the free
+// list in address order, which also improves locality of later allocations.
+//*************************************************************************
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include "V3Allocator.h"
+
+#include "V3Mutex.h"
+
+#include <algorithm>
+#include <array>
+#include <new>
+#include <vector>
+
+//######################################################################
+
+class V3AllocatorImp final {
+    // TYPES
+    struct FreeObj final {
+        FreeObj* m_nextp;  // Next free object in same size class
+    };
+    struct SizeClass final {
+        FreeObj* m_freep = nullptr;  // Free list
+        std::vector<char*> m_slabps;  // Slabs owned by this size class
+    };
+
+    // CONSTANTS
+    static constexpr size_t GRANULE = 16;  // Size class granularity, also object alignment
+    static constexpr size_t MAX_SIZE = 512;  // Larger objects use ::operator new
+    static constexpr size_t SLAB_SIZE = 64 * 1024;  // Bytes per slab
+    static constexpr size_t NCLASSES = MAX_SIZE / GRANULE;
+
+    // MEMBERS
+    V3Mutex m_mutex;  // Protects members
+    std::array<SizeClass, NCLASSES> m_classes VL_GUARDED_BY(m_mutex);
+    uint64_t m_bytesCurrent VL_GUARDED_BY(m_mutex) = 0;  // Bytes in slabs
+    uint64_t m_bytesPeak VL_GUARDED_BY(m_mutex) = 0;  // Maximum of m_bytesCurrent
+
+    // METHODS
+    static size_t classIndex(size_t size) { return (size - 1) / GRANULE; }
+    static size_t classSize(size_t index) { return (index + 1) * GRANULE; }
+    static uintptr_t addr(const void* p) { return reinterpret_cast<uintptr_t>(p); }
+
+    void newSlab(size_t index) VL_REQUIRES(m_mutex) {
+        SizeClass& sc = m_classes[index];
+        const size_t objSize = classSize(index);
+        char* const slabp = static_cast<char*>(::operator new(SLAB_SIZE));
+        sc.m_slabps.push_back(slabp);
+        // Push in reverse, so allocations walk the slab forwards
+        for (size_t offset = (SLAB_SIZE / objSize) * objSize; offset;) {
+            offset -= objSize;
+            FreeObj* const objp = reinterpret_cast<FreeObj*>(slabp + offset);
+            objp->m_nextp = sc.m_freep;
+            sc.m_freep = objp;
+        }
+        m_bytesCurrent += SLAB_SIZE;
+        m_bytesPeak = std::max(m_bytesPeak, m_bytesCurrent);
+    }
+
+    void trimClass(size_t index) VL_REQUIRES(m_mutex) {
+        SizeClass& sc = m_classes[index];
+        if (sc.m_slabps.empty()) return;
+        const size_t perSlab = SLAB_SIZE / classSize(index);
+        std::vector<FreeObj*> freeps;
+        for (FreeObj* objp = sc.m_freep; objp; objp = objp->m_nextp) freeps.push_back(objp);
+        const auto byAddr = [](const void* ap, const void* bp) { return addr(ap) < addr(bp); };
+        std::sort(freeps.begin(), freeps.end(), byAddr);
+        std::sort(sc.m_slabps.begin(), sc.m_slabps.end(), byAddr);
+        // Every free object is inside exactly one slab, so walk both in address order
+        std::vector<char*> keptps;
+        FreeObj* headp = nullptr;
+        FreeObj** tailpp = &headp;
+        auto it = freeps.begin();
+        for (char* const slabp : sc.m_slabps) {
+            const uintptr_t endAddr = addr(slabp + SLAB_SIZE);
+            auto endIt = it;
+            while (endIt != freeps.end() && addr(*endIt) < endAddr) ++endIt;
+            if (static_cast<size_t>(endIt - it) == perSlab) {
+                ::operator delete(slabp);
+                m_bytesCurrent -= SLAB_SIZE;
+            } else {
+                keptps.push_back(slabp);
+                for (; it != endIt; ++it) {
+                    *tailpp = *it;
+                    tailpp = &(*it)->m_nextp;
+                }
+            }
+            it = endIt;
+        }
+        *tailpp = nullptr;
+        sc.m_freep = headp;
+        sc.m_slabps = std::move(keptps);
+    }
+
+public:
+    // CONSTRUCTORS
+    V3AllocatorImp() = default;
+    VL_UNCOPYABLE(V3AllocatorImp);
+
+    // METHODS
+    void* allocate(size_t size) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        if (!VL_ALLOCATOR_POOL || VL_UNLIKELY(size > MAX_SIZE)) return ::operator new(size);
+        const size_t index = classIndex(size);
+        V3LockGuard lock{m_mutex};
+        SizeClass& sc = m_classes[index];
+        if (VL_UNLIKELY(!sc.m_freep)) newSlab(index);
+        FreeObj* const objp = sc.m_freep;
+        sc.m_freep = objp->m_nextp;
+        return objp;
+    }
+    void deallocate(void* objp, size_t size) VL_MT_SAFE_EXCLUDES(m_mutex) {
+        if (!objp) return;
+        if (!VL_ALLOCATOR_POOL || VL_UNLIKELY(size > MAX_SIZE)) {
+            ::operator delete(objp);
+            return;
+        }
+        V3LockGuard lock{m_mutex};
+        SizeClass& sc = m_classes[classIndex(size)];
+        FreeObj* const freep = static_cast<FreeObj*>(objp);
+        freep->m_nextp = sc.m_freep;
+        sc.m_freep = freep;
+    }
+    void trim() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        V3LockGuard lock{m_mutex};
+        for (size_t index = 0; index < NCLASSES; ++index) trimClass(index);
+    }
+    uint64_t bytesCurrent() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        V3LockGuard lock{m_mutex};
+        return m_bytesCurrent;
+    }
+    uint64_t bytesPeak() VL_MT_SAFE_EXCLUDES(m_mutex) {
+        V3LockGuard lock{m_mutex};
+        return m_bytesPeak;
+    }
+};
+
+// Never destroyed, as nodes in static objects may be freed during exit
+static V3AllocatorImp& allocatorImp() VL_MT_SAFE {
+    static V3AllocatorImp* const s_impp = new V3AllocatorImp;
+    return *s_impp;
+}
+
+//######################################################################
+// V3Allocator
+
+void* V3Allocator::allocate(size_t size) { return allocatorImp().allocate(size); }
+void V3Allocator::deallocate(void* objp, size_t size) { allocatorImp().deallocate(objp, size); }
+void V3Allocator::trim() { allocatorImp().trim(); }
+uint64_t V3Allocator::bytesCurrent() { return allocatorImp().bytesCurrent(); }
+uint64_t V3Allocator::bytesPeak() { return allocatorImp().bytesPeak(); }
@@ -0,0 +1,60 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Size class pool allocator for AST and graph nodes
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#ifndef VERILATOR_V3ALLOCATOR_H_
+#define VERILATOR_V3ALLOCATOR_H_
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include <cstddef>
+#include <cstdint>
+
+// Reusing freed objects' memory would hide use-after-free of nodes from ASan
+// and valgrind, so debug and address sanitizer builds give each object its
+// own ::operator new allocation instead of pooling.
+#if defined(VL_DEBUG) || defined(__SANITIZE_ADDRESS__)
+# define VL_ALLOCATOR_POOL 0
+#elif defined(__has_feature)
+# if __has_feature(address_sanitizer)
+#  define VL_ALLOCATOR_POOL 0
+# endif
+#endif
+#ifndef VL_ALLOCATOR_POOL
+# define VL_ALLOCATOR_POOL 1  ///< Pool small objects in slabs
+#endif
+
+//============================================================================
+// Small objects (AstNode, V3GraphVertex, V3GraphEdge) are allocated from
+// large slabs, with a free list per size class. Freed objects are reused by
+// later allocations of the same size class. Slabs that no longer hold any
+// live object are returned to the system by trim(), which is called after
+// the passes that delete many nodes at once (e.g.: V3Param and V3Dead).
+
+class V3Allocator final {
+public:
+    // Allocate an object of the given size
+    static void* allocate(size_t size) VL_MT_SAFE;
+    // Free an object previously returned by allocate(size)
+    static void deallocate(void* objp, size_t size) VL_MT_SAFE;
+    // Release unused slabs
+    static void trim() VL_MT_DISABLED;
+    // Bytes currently held in slabs, and maximum over the run
+    static uint64_t bytesCurrent() VL_MT_SAFE;
+    static uint64_t bytesPeak() VL_MT_SAFE;
+};
+
+#endif  // Guard
@@ -28,15 +28,16 @@ VL_DEFINE_DEBUG_FUNCTIONS;
 //======================================================================
 // Statics
 
-uint64_t VIsCached::s_cachedCntGbl = 1;
+std::atomic<uint64_t> VIsCached::s_cachedCntGbl{1};
 
 uint64_t AstNode::s_editCntLast = 0;
-uint64_t AstNode::s_editCntGbl = 0;  // Hot cache line
+std::atomic<uint64_t> AstNode::s_editCntGbl{0};  // Hot cache line
 
 // To allow for fast clearing of all user pointers, we keep a "timestamp"
 // along with each userp, and thus by bumping this count we can make it look
 // as if we iterated across the entire tree to set all the userp's to null.
-int AstNode::s_cloneCntGbl = 0;
+std::atomic<int> AstNode::s_cloneCntGbl{0};
+thread_local int AstNode::s_cloneCntCur = 0;
 uint32_t VNUser1InUse::s_userCntGbl = 0;  // Hot cache line, leave adjacent
 uint32_t VNUser2InUse::s_userCntGbl = 0;  // Hot cache line, leave adjacent
 uint32_t VNUser3InUse::s_userCntGbl = 0;  // Hot cache line, leave adjacent
@@ -20,6 +20,7 @@
 #include "config_build.h"
 #include "verilatedos.h"
 
+#include "V3Allocator.h"
 #include "V3Broken.h"
 #include "V3Error.h"
 #include "V3FileLine.h"
@@ -30,6 +31,7 @@
 
 #include "V3Ast__gen_forward_class_decls.h"  // From ./astgen
 
+#include <atomic>
 #include <cmath>
 #include <cstdint>
 #include <functional>
@@ -173,6 +175,11 @@ public:
 //  This will clear the tree, and prevent another visitor from clobbering
 //  user2.  When the member goes out of scope it will be automagically
 //  freed up.
+//
+//  The AstUserInUse must be declared on the main thread. Jobs submitted
+//  to a V3ThreadScope under it may then set and read user*() on nodes,
+//  provided each job only touches nodes in its own disjoint subtree
+//  (e.g.: one module or one function per job).
 
 class VNUserInUseBase VL_NOT_FINAL {
 protected:
@@ -434,11 +441,12 @@ class AstNode VL_NOT_FINAL {
     // In the release build we will take the space saving instead.
     uint64_t m_editCount;  // When it was last edited
 #endif
-    static uint64_t s_editCntGbl;  // Global edit counter
+    static std::atomic<uint64_t> s_editCntGbl;  // Global edit counter
     static uint64_t s_editCntLast;  // Last committed value of global edit counter
 
     AstNode* m_clonep = nullptr;  // Pointer to clone/source of node (only for *LAST* cloneTree())
-    static int s_cloneCntGbl;  // Count of which userp is set
+    static std::atomic<int> s_cloneCntGbl;  // Source of unique clone sequence numbers
+    static thread_local int s_cloneCntCur;  // This thread's sequence number of last cloneTree()
 
     // This member ordering both allows 64 bit alignment and puts associated data together
     VNUser m_user1u{0};  // Contains any information the user iteration routine wants
@@ -519,11 +527,13 @@ protected:
 
     void clonep(AstNode* nodep) {
         m_clonep = nodep;
-        m_cloneCnt = s_cloneCntGbl;
+        m_cloneCnt = s_cloneCntCur;
     }
     static void cloneClearTree() {
-        s_cloneCntGbl++;
-        UASSERT_STATIC(s_cloneCntGbl, "Rollover");
+        // Sequence numbers are unique across threads, so concurrent cloneTree() calls on
+        // disjoint subtrees never see each other's clonep()
+        s_cloneCntCur = ++s_cloneCntGbl;
+        UASSERT_STATIC(s_cloneCntCur, "Rollover");
     }
 
     // Use instead isSame(), this is for each Ast* class, and assumes node is of same type
@@ -545,7 +555,7 @@ public:
     AstNode* op3p() const VL_MT_STABLE { return m_op3p; }
     AstNode* op4p() const VL_MT_STABLE { return m_op4p; }
     AstNodeDType* dtypep() const VL_MT_STABLE { return m_dtypep; }
-    AstNode* clonep() const { return ((m_cloneCnt == s_cloneCntGbl) ? m_clonep : nullptr); }
+    AstNode* clonep() const { return ((m_cloneCnt == s_cloneCntCur) ? m_clonep : nullptr); }
     AstNode* firstAbovep() const {  // Returns nullptr when second or later in list
         return ((backp() && backp()->nextp() != this) ? backp() : nullptr);
     }
@@ -562,6 +572,9 @@ public:
 #ifdef VL_LEAK_CHECKS
     static void* operator new(size_t size);
     static void operator delete(void* obj, size_t size);
+#else
+    static void* operator new(size_t size) { return V3Allocator::allocate(size); }
+    static void operator delete(void* objp, size_t size) { V3Allocator::deallocate(objp, size); }
 #endif
 
     // CONSTANTS
@@ -703,14 +716,17 @@ public:
 #ifdef VL_DEBUG
     uint64_t editCount() const { return m_editCount; }
     void editCountInc() {
-        m_editCount = ++s_editCntGbl;  // Preincrement, so can "watch AstNode::s_editCntGbl=##"
+        // Preincrement, so can "watch AstNode::s_editCntGbl=##"
+        m_editCount = s_editCntGbl.fetch_add(1, std::memory_order_relaxed) + 1;
         VIsCached::clearCacheTree();  // Any edit clears all caching
     }
 #else
-    void editCountInc() { ++s_editCntGbl; }
+    void editCountInc() { s_editCntGbl.fetch_add(1, std::memory_order_relaxed); }
 #endif
     static uint64_t editCountLast() VL_MT_SAFE { return s_editCntLast; }
-    static uint64_t editCountGbl() VL_MT_SAFE { return s_editCntGbl; }
+    static uint64_t editCountGbl() VL_MT_SAFE {
+        return s_editCntGbl.load(std::memory_order_relaxed);
+    }
     static void editCountSetLast() { s_editCntLast = editCountGbl(); }
 
     // ACCESSORS for specific types
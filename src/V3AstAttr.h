@@ -1242,16 +1242,18 @@ class VIsCached final {
     // else if cachedCnt == s_cachedCntGbl, then m_state is if cached
     uint64_t m_cachedCnt : 63;  // Mark of when cache was computed
     uint64_t m_state : 1;
-    static uint64_t s_cachedCntGbl;  // Global computed count
+    static std::atomic<uint64_t> s_cachedCntGbl;  // Global computed count
 
 public:
     VIsCached()
         : m_cachedCnt{0}
         , m_state{0} {}
-    bool isCached() const { return m_cachedCnt == s_cachedCntGbl; }
+    bool isCached() const {
+        return m_cachedCnt == s_cachedCntGbl.load(std::memory_order_relaxed);
+    }
     bool get() const { return m_state; }
     void set(bool flag) {
-        m_cachedCnt = s_cachedCntGbl;
+        m_cachedCnt = s_cachedCntGbl.load(std::memory_order_relaxed);
         m_state = flag;
     }
     void clearCache() {
@@ -1259,7 +1261,7 @@ public:
         m_state = 0;
     }
     static void clearCacheTree() {
-        ++s_cachedCntGbl;
+        s_cachedCntGbl.fetch_add(1, std::memory_order_relaxed);
         // 64 bits so won't overflow
         // UASSERT_STATIC(s_cachedCntGbl < MAX_CNT, "Overflow of cache counting");
     }
@@ -552,7 +552,7 @@ public:
     void scopep(AstScope* nodep) { m_scopep = nodep; }
     string rtnTypeVoid() const { return ((m_rtnType == "") ? "void" : m_rtnType); }
     void rtnType(const string& rtnType) { m_rtnType = rtnType; }
-    bool dontCombine() const { return m_dontCombine || isTrace() || entryPoint(); }
+    bool dontCombine() const { return m_dontCombine || entryPoint(); }
     void dontCombine(bool flag) { m_dontCombine = flag; }
     bool declPrivate() const { return m_declPrivate; }
     void declPrivate(bool flag) { m_declPrivate = flag; }
@@ -1244,6 +1244,7 @@ class AstNetlist final : public AstNode {
     // @astgen ptr := m_evalNbap : Optional[AstCFunc]  // The '_eval__nba' function
     // @astgen ptr := m_dpiExportTriggerp : Optional[AstVarScope]  // DPI export trigger variable
     // @astgen ptr := m_delaySchedulerp : Optional[AstVar]  // Delay scheduler variable
+    // @astgen ptr := m_vpiDirtyp : Optional[AstVar]  // VPI value change flags variable
     // @astgen ptr := m_nbaEventp : Optional[AstVarScope]  // NBA event variable
     // @astgen ptr := m_nbaEventTriggerp : Optional[AstVarScope]  // NBA event trigger
     // @astgen ptr := m_topScopep : Optional[AstTopScope]  // Singleton AstTopScope
@@ -1273,6 +1274,8 @@ public:
     void dpiExportTriggerp(AstVarScope* varScopep) { m_dpiExportTriggerp = varScopep; }
     AstVar* delaySchedulerp() const { return m_delaySchedulerp; }
     void delaySchedulerp(AstVar* const varScopep) { m_delaySchedulerp = varScopep; }
+    AstVar* vpiDirtyp() const { return m_vpiDirtyp; }
+    void vpiDirtyp(AstVar* const varp) { m_vpiDirtyp = varp; }
     AstVarScope* nbaEventp() const { return m_nbaEventp; }
     void nbaEventp(AstVarScope* const varScopep) { m_nbaEventp = varScopep; }
     AstVarScope* nbaEventTriggerp() const { return m_nbaEventTriggerp; }
@@ -1483,6 +1486,7 @@ class AstScope final : public AstNode {
 
     // An AstScope->name() is special: . indicates an uninlined scope, __DOT__ an inlined scope
     string m_name;  // Name
+    uint32_t m_vpiDirtyBase = 0;  // First VPI dirty flag of the variables in this scope
 public:
     AstScope(FileLine* fl, AstNodeModule* modp, const string& name, AstScope* aboveScopep,
              AstCell* aboveCellp)
@@ -1508,6 +1512,8 @@ public:
     AstScope* aboveScopep() const VL_MT_SAFE { return m_aboveScopep; }
     AstCell* aboveCellp() const { return m_aboveCellp; }
     bool isTop() const VL_MT_SAFE { return aboveScopep() == nullptr; }  // At top of hierarchy
+    uint32_t vpiDirtyBase() const { return m_vpiDirtyBase; }
+    void vpiDirtyBase(uint32_t base) { m_vpiDirtyBase = base; }
     // Create new MODULETEMP variable under this scope
     AstVarScope* createTemp(const string& name, unsigned width);
     AstVarScope* createTemp(const string& name, AstNodeDType* dtypep);
@@ -1709,6 +1715,9 @@ class AstTypeTable final : public AstNode {
     //
     using DetailedMap = std::map<VBasicTypeKey, AstBasicDType*>;
     DetailedMap m_detailedMap;
+    static V3Mutex s_mutex;  // Protects members, as passes may look up types in parallel
+
+    AstBasicDType* findCreateSameDTypeLocked(AstBasicDType& node) VL_REQUIRES(s_mutex);
 
 public:
     explicit AstTypeTable(FileLine* fl);
@@ -1873,6 +1882,7 @@ class AstVar final : public AstNode {
     VLifetime m_lifetime;  // Lifetime
     VRandAttr m_rand;  // Randomizability of this variable (rand, randc, etc)
     int m_pinNum = 0;  // For JSON, if non-zero the connection pin number
+    int m_vpiDirtyIndex = -1;  // Index in the module's VPI dirty flags, -1 = none
     bool m_ansi : 1;  // Params or pins declared in the module header, rather than the body
     bool m_declTyped : 1;  // Declared as type (for dedup check)
     bool m_tristate : 1;  // Inout or triwire or trireg
@@ -2237,6 +2247,8 @@ public:
     VLifetime lifetime() const { return m_lifetime; }
     void pinNum(int id) { m_pinNum = id; }
     int pinNum() const { return m_pinNum; }
+    void vpiDirtyIndex(int index) { m_vpiDirtyIndex = index; }
+    int vpiDirtyIndex() const { return m_vpiDirtyIndex; }
     void propagateAttrFrom(const AstVar* fromp) {
         // This is getting connected to fromp; keep attributes
         // Note the method below too
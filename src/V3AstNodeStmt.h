@@ -1267,7 +1267,13 @@ public:
     int instrCount() const override { return 10 + 2 * INSTR_COUNT_LD; }
     bool hasDType() const override VL_MT_SAFE { return true; }
     bool sameNode(const AstNode* samep) const override {
-        return declp() == VN_DBG_AS(samep, TraceInc)->declp();
+        // Same if emits the same dump call, possibly for another instance (--trace-share)
+        const AstTraceInc* const asamep = VN_DBG_AS(samep, TraceInc);
+        return traceType() == asamep->traceType()
+               && declp()->code() - baseCode() == asamep->declp()->code() - asamep->baseCode()
+               && declp()->widthMin() == asamep->declp()->widthMin()
+               && declp()->arrayRange().ranged() == asamep->declp()->arrayRange().ranged()
+               && declp()->arrayRange().elements() == asamep->declp()->arrayRange().elements();
     }
     bool isGateOptimizable() const override { return false; }
     bool isPredictOptimizable() const override { return false; }
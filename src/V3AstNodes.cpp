@@ -1314,6 +1314,8 @@ bool AstSenTree::hasHybrid() const {
     return false;
 }
 
+V3Mutex AstTypeTable::s_mutex;
+
 AstTypeTable::AstTypeTable(FileLine* fl)
     : ASTGEN_SUPER_TypeTable(fl) {
     for (int i = 0; i < VBasicDTypeKwd::_ENUM_MAX; ++i) m_basicps[i] = nullptr;
@@ -1341,6 +1343,7 @@ void AstTypeTable::repairCache() {
 }
 
 AstConstraintRefDType* AstTypeTable::findConstraintRefDType(FileLine* fl) {
+    const V3LockGuard lock{s_mutex};
     if (VL_UNLIKELY(!m_constraintRefp)) {
         AstConstraintRefDType* const newp = new AstConstraintRefDType{fl};
         addTypesp(newp);
@@ -1349,6 +1352,7 @@ AstConstraintRefDType* AstTypeTable::findConstraintRefDType(FileLine* fl) {
     return m_constraintRefp;
 }
 AstEmptyQueueDType* AstTypeTable::findEmptyQueueDType(FileLine* fl) {
+    const V3LockGuard lock{s_mutex};
     if (VL_UNLIKELY(!m_emptyQueuep)) {
         AstEmptyQueueDType* const newp = new AstEmptyQueueDType{fl};
         addTypesp(newp);
@@ -1357,6 +1361,7 @@ AstEmptyQueueDType* AstTypeTable::findEmptyQueueDType(FileLine* fl) {
     return m_emptyQueuep;
 }
 AstStreamDType* AstTypeTable::findStreamDType(FileLine* fl) {
+    const V3LockGuard lock{s_mutex};
     if (VL_UNLIKELY(!m_streamp)) {
         AstStreamDType* const newp = new AstStreamDType{fl};
         addTypesp(newp);
@@ -1365,14 +1370,17 @@ AstStreamDType* AstTypeTable::findStreamDType(FileLine* fl) {
     return m_streamp;
 }
 AstQueueDType* AstTypeTable::findQueueIndexDType(FileLine* fl) {
+    AstNodeDType* const indexDTypep = AstNode::findUInt32DType();  // Before lock, also locks
+    const V3LockGuard lock{s_mutex};
     if (VL_UNLIKELY(!m_queueIndexp)) {
-        AstQueueDType* const newp = new AstQueueDType{fl, AstNode::findUInt32DType(), nullptr};
+        AstQueueDType* const newp = new AstQueueDType{fl, indexDTypep, nullptr};
         addTypesp(newp);
         m_queueIndexp = newp;
     }
     return m_queueIndexp;
 }
 AstVoidDType* AstTypeTable::findVoidDType(FileLine* fl) {
+    const V3LockGuard lock{s_mutex};
     if (VL_UNLIKELY(!m_voidp)) {
         AstVoidDType* const newp = new AstVoidDType{fl};
         addTypesp(newp);
@@ -1382,11 +1390,12 @@ AstVoidDType* AstTypeTable::findVoidDType(FileLine* fl) {
 }
 
 AstBasicDType* AstTypeTable::findBasicDType(FileLine* fl, VBasicDTypeKwd kwd) {
+    const V3LockGuard lock{s_mutex};
     // Because the detailed map doesn't update m_basicps, check the detailed
     // map for this same node. Also adds this new node to the detailed map
     if (!m_basicps[kwd]) {
         AstBasicDType basic{fl, kwd};
-        m_basicps[kwd] = findCreateSameDType(basic);
+        m_basicps[kwd] = findCreateSameDTypeLocked(basic);
     }
     return m_basicps[kwd];
 }
@@ -1405,6 +1414,11 @@ AstBasicDType* AstTypeTable::findLogicBitDType(FileLine* fl, VBasicDTypeKwd kwd,
 }
 
 AstBasicDType* AstTypeTable::findCreateSameDType(AstBasicDType& node) {
+    const V3LockGuard lock{s_mutex};
+    return findCreateSameDTypeLocked(node);
+}
+
+AstBasicDType* AstTypeTable::findCreateSameDTypeLocked(AstBasicDType& node) {
     const VBasicTypeKey key{node.width(), node.widthMin(), node.numeric(), node.keyword(),
                             node.nrange()};
     AstBasicDType*& entryr = m_detailedMap[key];
@@ -1420,6 +1434,7 @@ AstBasicDType* AstTypeTable::findCreateSameDType(AstBasicDType& node) {
 AstBasicDType* AstTypeTable::findInsertSameDType(AstBasicDType* nodep) {
     const VBasicTypeKey key{nodep->width(), nodep->widthMin(), nodep->numeric(), nodep->keyword(),
                             nodep->nrange()};
+    const V3LockGuard lock{s_mutex};
     auto pair = m_detailedMap.emplace(key, nodep);
     if (pair.second) nodep->generic(true);
     // No addTypesp; the upper function that called new() is responsible for adding
@@ -2476,6 +2491,7 @@ void AstNetlist::deleteContents() {
     m_evalNbap = nullptr;
     m_dpiExportTriggerp = nullptr;
     m_delaySchedulerp = nullptr;
+    m_vpiDirtyp = nullptr;
     m_nbaEventp = nullptr;
     m_nbaEventTriggerp = nullptr;
     m_topScopep = nullptr;
@@ -19,8 +19,10 @@
 #include "V3Control.h"
 
 #include "V3InstrCount.h"
+#include "V3Stats.h"
 #include "V3String.h"
 
+#include <cmath>
 #include <memory>
 #include <set>
 #include <unordered_map>
@@ -573,6 +575,10 @@ class V3ControlResolver final {
     V3ControlScopeTraceResolver m_scopeTraces;  // Regexp to trace enables
     std::unordered_map<string, std::unordered_map<string, uint64_t>>
         m_profileData;  // Access to profile_data records
+    // Per model, per key, cost from each profile file, when merging other than by sum
+    std::unordered_map<string, std::unordered_map<string, std::map<string, uint64_t>>>
+        m_profileFileData;
+    bool m_profileMerged = false;  // m_profileData has been computed from m_profileFileData
     uint8_t m_mode = NONE;
     std::unordered_map<string, V3ControlResolverHierWorkerEntry> m_hierWorkers;
     FileLine* m_profileFileLine = nullptr;
@@ -599,13 +605,15 @@ public:
         if (cost == 0) cost = 1;  // Cost 0 means delete (or no data)
         if (mode == MTASK) {
             m_profileData[model][key] += cost;
+            m_profileFileData[model][key][fl->filename()] += cost;
+            m_profileMerged = false;
         } else if (mode == HIER_DPI) {
             m_profileData[model][key] = std::max(m_profileData[model][key], cost);
         }
         m_mode |= mode;
     }
     bool containsMTaskProfileData() const { return m_mode & MTASK; }
-    uint64_t getProfileData(const string& hierDpi) const {
+    uint64_t getProfileData(const string& hierDpi) {
         // Empty key for hierarchical DPI wrapper costs.
         return getProfileData(hierDpi, "");
     }
@@ -622,7 +630,70 @@ public:
         const auto mit = m_hierWorkers.find(model);
         return mit != m_hierWorkers.cend() ? mit->second.flp() : v3Global.rootp()->fileline();
     }
-    uint64_t getProfileData(const string& model, const string& key) const {
+    // With --prof-pgo-merge other than 'sum', combine the mtask costs from each profile file.
+    // Costs are first scaled so each file has the same total cost per model, so a long run does
+    // not dominate short ones, then the mean or a percentile over the files is taken.  An mtask
+    // missing from a file with data for the model is a zero cost sample from that file.
+    void mergeProfileData() {
+        m_profileMerged = true;
+        const string& merge = v3Global.opt.profPgoMerge();
+        if (merge == "sum") return;
+        int percentile = -1;  // -1 for mean
+        if (merge == "max") {
+            percentile = 100;
+        } else if (merge[0] == 'p') {
+            percentile = std::atoi(merge.c_str() + 1);
+        }
+        uint64_t highVariance = 0;
+        double maxVariation = 0;
+        for (auto& modelIt : m_profileFileData) {
+            std::map<string, double> fileTotals;
+            for (const auto& keyIt : modelIt.second) {
+                for (const auto& fileIt : keyIt.second) fileTotals[fileIt.first] += fileIt.second;
+            }
+            double meanTotal = 0;
+            for (const auto& it : fileTotals) meanTotal += it.second;
+            meanTotal /= fileTotals.size();
+            for (const auto& keyIt : modelIt.second) {
+                std::vector<double> costs;
+                for (const auto& totalIt : fileTotals) {
+                    const auto fileIt = keyIt.second.find(totalIt.first);
+                    if (fileIt == keyIt.second.end()) {
+                        costs.push_back(0);
+                    } else {
+                        costs.push_back(fileIt->second * meanTotal / totalIt.second);
+                    }
+                }
+                std::sort(costs.begin(), costs.end());
+                double mean = 0;
+                for (const double cost : costs) mean += cost;
+                mean /= costs.size();
+                double variance = 0;
+                for (const double cost : costs) variance += (cost - mean) * (cost - mean);
+                variance /= costs.size();
+                // Coefficient of variation, to find mtasks with workload dependent cost
+                const double variation = mean > 0 ? std::sqrt(variance) / mean : 0;
+                maxVariation = std::max(maxVariation, variation);
+                if (variation > 0.25) ++highVariance;
+                UINFO(9, "Profile " << modelIt.first << " " << keyIt.first << " samples "
+                                    << costs.size() << " mean " << mean << " variation "
+                                    << variation);
+                double merged = mean;
+                if (percentile >= 0) {
+                    // Nearest rank percentile
+                    const size_t rank = static_cast<size_t>(
+                        std::ceil(percentile / 100.0 * static_cast<double>(costs.size())));
+                    merged = costs[rank ? rank - 1 : 0];
+                }
+                m_profileData[modelIt.first][keyIt.first]
+                    = std::max<uint64_t>(1, static_cast<uint64_t>(std::round(merged)));
+            }
+        }
+        V3Stats::addStat("Profile data, mtask cost max variation", maxVariation, 3);
+        V3Stats::addStat("Profile data, mtasks with high variation", highVariance);
+    }
+    uint64_t getProfileData(const string& model, const string& key) {
+        if (VL_UNLIKELY(!m_profileMerged)) mergeProfileData();
         const auto mit = m_profileData.find(model);
         if (mit == m_profileData.cend()) return 0;
         const auto it = mit->second.find(key);
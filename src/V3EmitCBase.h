@@ -149,6 +149,7 @@ public:
     // Close current output file. Sets ofp() and outFileNodep() to nullptr.
     void closeOutputFile() {
         UASSERT(m_ofp, "No currently open output file");
+        m_ofp->close();
         VL_DO_CLEAR(delete m_ofp, m_ofp = nullptr);
         m_cfilep->complexityScore(m_splitSize);
         m_cfilep = nullptr;
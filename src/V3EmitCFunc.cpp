@@ -26,6 +26,9 @@
 // We use a static char array in VL_VALUE_STRING
 constexpr int VL_VALUE_STRING_MAX_WIDTH = 8192;
 
+// Wide operations up to this many words call the fixed-width template functions
+constexpr int VL_WIDE_TEMPLATE_WORDS = 8;
+
 //######################################################################
 // EmitCFunc
 
@@ -47,6 +50,8 @@ void EmitCFunc::emitOpName(AstNode* nodep, const string& format, AstNode* lhsp,
     //   %nq      emitIQW on the [node]
     //   %nw      width in bits
     //   %nW      width in words
+    //   %nT      template argument with width in words, if fixed-width function exists;
+    //            a following %nW is then suppressed
     //   %ni      iterate
     //  %l*     lhsp - if appropriate, then second char as above
     //  %r*     rhsp - if appropriate, then second char as above
@@ -58,6 +63,7 @@ void EmitCFunc::emitOpName(AstNode* nodep, const string& format, AstNode* lhsp,
     putnbs(nodep, "");
 
     bool needComma = false;
+    bool templated = false;  // Emitted %nT, so width is not an argument
     string nextComma;
     auto commaOut = [&out, &nextComma]() {
         if (!nextComma.empty()) {
@@ -139,8 +145,14 @@ void EmitCFunc::emitOpName(AstNode* nodep, const string& format, AstNode* lhsp,
                     out += cvtToStr(detailp->widthMin());
                     needComma = true;
                     break;
+                case 'T':
+                    if (detailp->isWide() && detailp->widthWords() <= VL_WIDE_TEMPLATE_WORDS) {
+                        out += "<" + cvtToStr(detailp->widthWords()) + ">";
+                        templated = true;
+                    }
+                    break;
                 case 'W':
-                    if (lhsp->isWide()) {
+                    if (lhsp->isWide() && !templated) {
                         commaOut();
                         out += cvtToStr(lhsp->widthWords());
                         needComma = true;
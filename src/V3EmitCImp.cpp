@@ -702,8 +702,17 @@ class EmitCTrace final : public EmitCFunc {
     }
 
     void emitTraceChangeOne(AstTraceInc* nodep, int arrayindex) {
+        const bool toggle = v3Global.opt.useTraceToggle();
+        // SAIF has no activity for reals and events, so they need no code
+        if (toggle
+            && (nodep->dtypep()->basicp()->isDouble() || nodep->dtypep()->basicp()->isEvent())) {
+            return;
+        }
         // Note: Both VTraceType::CHANGE and VTraceType::FULL use the 'full' methods
-        const std::string func = nodep->traceType() == VTraceType::CHANGE ? "chg" : "full";
+        // SAIF accumulates the toggles on all dumps, so always uses the 'tog' methods
+        const std::string func = toggle                                    ? "tog"
+                                 : nodep->traceType() == VTraceType::CHANGE ? "chg"
+                                                                             : "full";
         bool emitWidth = true;
         string stype;
         if (nodep->dtypep()->basicp()->isDouble()) {
@@ -741,6 +750,44 @@ class EmitCTrace final : public EmitCFunc {
         puts(");\n");
     }
 
+    bool emitTraceChangeArray(AstTraceInc* nodep) {
+        // Check all elements of a simple 1-D array with one call, so unchanged
+        // elements are skipped in bulk. Returns false if the array is not eligible.
+        if (nodep->traceType() != VTraceType::CHANGE) return false;
+        if (v3Global.opt.useTraceOffload()) return false;  // Offload checks on worker thread
+        if (v3Global.opt.useTraceToggle()) return false;  // Each element compares inline
+        const AstVarRef* const varrefp = VN_CAST(nodep->valuep(), VarRef);
+        if (!varrefp || varrefp->varp()->isSc()) return false;
+        const AstBasicDType* const basicp = nodep->dtypep()->basicp();
+        if (basicp->isDouble() || basicp->isEvent()) return false;
+        const int elements = nodep->declp()->arrayRange().elements();
+        string stype;
+        bool emitWidth = true;
+        if (nodep->isWide()) {
+            stype = "WData";
+        } else if (nodep->isQuad()) {
+            stype = "QData";
+        } else if (nodep->declp()->widthMin() > 16) {
+            stype = "IData";
+        } else if (nodep->declp()->widthMin() > 8) {
+            stype = "SData";
+        } else if (nodep->declp()->widthMin() > 1) {
+            stype = "CData";
+        } else {
+            stype = "Bit";
+            emitWidth = false;
+        }
+        putns(nodep, "bufp->chg" + stype + "Array(oldp+");
+        puts(cvtToStr(nodep->declp()->code() - nodep->baseCode()));
+        puts(",");
+        iterateConst(nodep->valuep());
+        puts(".m_storage,");
+        puts(cvtToStr(elements));
+        if (emitWidth) puts("," + cvtToStr(nodep->declp()->widthMin()));
+        puts(");\n");
+        return true;
+    }
+
     void emitTraceValue(const AstTraceInc* nodep, int arrayindex) {
         if (AstVarRef* const varrefp = VN_CAST(nodep->valuep(), VarRef)) {
             const AstVar* const varp = varrefp->varp();
@@ -819,6 +866,7 @@ class EmitCTrace final : public EmitCFunc {
     }
     void visit(AstTraceInc* nodep) override {
         if (nodep->declp()->arrayRange().ranged()) {
+            if (emitTraceChangeArray(nodep)) return;
             // It traces faster if we unroll the loop
             for (int i = 0; i < nodep->declp()->arrayRange().elements(); i++) {
                 emitTraceChangeOne(nodep, i);
@@ -833,9 +881,13 @@ class EmitCTrace final : public EmitCFunc {
         m_modp = v3Global.rootp()->topModulep();
         // Open output file
         openNextOutputFile();
-        // Emit functions
-        for (AstNode* nodep = m_modp->stmtsp(); nodep; nodep = nodep->nextp()) {
-            if (AstCFunc* const funcp = VN_CAST(nodep, CFunc)) iterateConst(funcp);
+        // Emit functions. These are under the top module, apart from those shared between
+        // instances with --trace-share.
+        for (AstNode* modp = v3Global.rootp()->modulesp(); modp; modp = modp->nextp()) {
+            m_modp = VN_AS(modp, NodeModule);
+            for (AstNode* nodep = m_modp->stmtsp(); nodep; nodep = nodep->nextp()) {
+                if (AstCFunc* const funcp = VN_CAST(nodep, CFunc)) iterateConst(funcp);
+            }
         }
         // Close output file
         closeOutputFile();
@@ -126,6 +126,8 @@ class CMakeEmitter final {
         cmake_set_raw(*of, name + "_TRACE_FST", (v3Global.opt.traceEnabledFst()) ? "1" : "0");
         *of << "# SAIF Tracing output mode? 0/1 (from --trace-saif)\n";
         cmake_set_raw(*of, name + "_TRACE_SAIF", (v3Global.opt.traceEnabledSaif()) ? "1" : "0");
+        *of << "# VBT Tracing output mode? 0/1 (from --trace-vbt)\n";
+        cmake_set_raw(*of, name + "_TRACE_VBT", (v3Global.opt.traceEnabledVbt()) ? "1" : "0");
         *of << "# VCD Tracing output mode?  0/1 (from --trace-vcd)\n";
         cmake_set_raw(*of, name + "_TRACE_VCD", (v3Global.opt.traceEnabledVcd()) ? "1" : "0");
 
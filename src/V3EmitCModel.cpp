@@ -519,6 +519,10 @@ class EmitCModel final : public EmitCFunc {
             puts(v3Global.opt.useTraceParallel() ? "true" : "false");
             puts(v3Global.opt.useTraceOffload() ? ", true" : ", false");
             puts(v3Global.opt.useFstWriterThread() ? ", true" : ", false");
+            // FST parallel tracing uses its own workers, plus the main thread
+            if (v3Global.opt.useTraceParallelFst()) {
+                puts(", " + cvtToStr(v3Global.opt.traceThreads() - 1));
+            }
             puts("}};\n");
             puts("};\n");
         }
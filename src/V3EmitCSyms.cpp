@@ -115,6 +115,7 @@ class EmitCSyms final : EmitCBaseVisitorConst {
     void emitSplit(std::vector<std::string>& stmts, const std::string& name, size_t max_stmts);
 
     std::vector<std::string> getSymCtorStmts();
+    std::vector<std::string> getSymVarsStmts();
     std::vector<std::string> getSymDtorStmts();
 
     static size_t stmtCost(const std::string& stmt) {
@@ -486,6 +487,11 @@ void EmitCSyms::emitSymHdr() {
         puts("bool __Vm_even_cycle__ico = false;\n");
         puts("bool __Vm_even_cycle__act = false;\n");
         puts("bool __Vm_even_cycle__nba = false;\n");
+        if (v3Global.opt.threadsDynamic()) {
+            puts("VlMTaskReadyQueue __Vm_mtaskready__ico;\n");
+            puts("VlMTaskReadyQueue __Vm_mtaskready__act;\n");
+            puts("VlMTaskReadyQueue __Vm_mtaskready__nba;\n");
+        }
     }
 
     if (v3Global.opt.profExec()) {
@@ -538,6 +544,7 @@ void EmitCSyms::emitSymHdr() {
 
     puts("\n// METHODS\n");
     puts("const char* name() const { return TOP.vlNamep; }\n");
+    if (!m_scopeVars.empty()) puts("void varsSetup() override;\n");
 
     if (v3Global.hasEvents()) {
         if (v3Global.assignsEvents()) {
@@ -763,6 +770,30 @@ std::vector<std::string> EmitCSyms::getSymCtorStmts() {
         }
     }
 
+    // VPI value change flags, see V3VpiDirty
+    const AstVar* const dirtyVarp = v3Global.rootp()->vpiDirtyp();
+    if (dirtyVarp) {
+        const AstScope* const topScopep = v3Global.rootp()->topScopep()->scopep();
+        const AstUnpackArrayDType* const dtypep
+            = VN_AS(dirtyVarp->dtypep()->skipRefp(), UnpackArrayDType);
+        add("// Setup VPI value change flags");
+        add("__Vm_vpiDirtyp = &("
+            + VIdProtect::protectIf(topScopep->nameDotless(), topScopep->protect()) + "."
+            + protect(dirtyVarp->name()) + "[0]);");
+        add("__Vm_vpiDirtySize = " + std::to_string(dtypep->elementsConst()) + ";");
+    }
+
+    return stmts;
+}
+
+std::vector<std::string> EmitCSyms::getSymVarsStmts() {
+    // Public variables are inserted on the first variable lookup, not at construction,
+    // see VerilatedSyms::varsInit
+    std::vector<std::string> stmts;
+
+    const auto add = [&stmts](const std::string& stmt) { stmts.emplace_back(stmt); };
+
+    const AstVar* const dirtyVarp = v3Global.rootp()->vpiDirtyp();
     // It would be less code if each module inserted its own variables. Someday.
     if (!m_scopeVars.empty()) {
         add("// Setup public variables");
@@ -834,6 +865,13 @@ std::vector<std::string> EmitCSyms::getSymCtorStmts() {
             stmt += bounds;
             stmt += ");";
             add(stmt);
+
+            if (dirtyVarp && varp->vpiDirtyIndex() >= 0) {
+                const uint32_t index = scopep->vpiDirtyBase() + varp->vpiDirtyIndex();
+                add(protect("__Vscopep_" + svd.m_scopeName) + "->varDirtyIndex(\""
+                    + V3OutFormatter::quoteNameControls(protect(svd.m_varBasePretty)) + "\", "
+                    + std::to_string(index) + ");");
+            }
         }
     }
 
@@ -922,6 +960,7 @@ void EmitCSyms::emitSymImp(const AstNetlist* netlistp) {
 
     // Get the body of the constructor and destructor
     std::vector<std::string> ctorStmts = getSymCtorStmts();
+    std::vector<std::string> varsStmts = getSymVarsStmts();
     std::vector<std::string> dtorStmts = getSymDtorStmts();
 
     // Check if needs splitting and if so split into sub-functions
@@ -945,6 +984,16 @@ void EmitCSyms::emitSymImp(const AstNetlist* netlistp) {
             emitSplit(ctorStmts, "ctor", maxCost);
             emitSplit(dtorStmts, "dtor", maxCost);
         }
+        // Variables are in their own function, split separately
+        size_t varsCost = 0;
+        for (const std::string& stmt : varsStmts) {
+            varsCost += stmtCost(stmt);
+            if (varsCost > maxCost) break;
+        }
+        if (varsCost > maxCost) {
+            v3Global.useParallelBuild(true);  // Splitting files, so using parallel build.
+            emitSplit(varsStmts, "vars", maxCost);
+        }
     }
 
     openNewOutputSourceFile(symClassName(), true, true, "Symbol table implementation internals");
@@ -989,6 +1038,17 @@ void EmitCSyms::emitSymImp(const AstNetlist* netlistp) {
     }
     puts("}\n");
 
+    // Public variables
+    if (!varsStmts.empty()) {
+        puts("\nvoid " + symClassName() + "::varsSetup() {\n");
+        for (const std::string& stmt : varsStmts) {
+            ofp()->putsNoTracking("    ");
+            ofp()->putsNoTracking(stmt);
+            ofp()->putsNoTracking("\n");
+        }
+        puts("}\n");
+    }
+
     // Methods
     if (v3Global.needTraceDumper()) {
         if (!optSystemC()) {
@@ -491,6 +491,7 @@ public:
         for (const string& file : entry.m_concatenatedFilenames) {
             concatenatingFile.puts("#include \"" + file + ".cpp\"\n");
         }
+        concatenatingFile.close();
     }
 
     void putMakeClassEntry(V3OutMkFile& of, const string& name) {
@@ -551,7 +552,7 @@ public:
         of.puts("VM_PARALLEL_BUILDS = ");
         of.puts(v3Global.useParallelBuild() ? "1" : "0");
         of.puts("\n");
-        of.puts("# Tracing output mode?  0/1 (from --trace-fst/--trace-saif/--trace-vcd)\n");
+        of.puts("# Tracing output mode?  0/1 (from --trace-fst/--trace-saif/--trace-vbt/--trace-vcd)\n");
         of.puts("VM_TRACE = ");
         of.puts(v3Global.opt.trace() ? "1" : "0");
         of.puts("\n");
@@ -563,6 +564,10 @@ public:
         of.puts("VM_TRACE_SAIF = ");
         of.puts(v3Global.opt.traceEnabledSaif() ? "1" : "0");
         of.puts("\n");
+        of.puts("# Tracing output mode in VBT format?  0/1 (from --trace-vbt)\n");
+        of.puts("VM_TRACE_VBT = ");
+        of.puts(v3Global.opt.traceEnabledVbt() ? "1" : "0");
+        of.puts("\n");
         of.puts("# Tracing output mode in VCD format?  0/1 (from --trace-vcd)\n");
         of.puts("VM_TRACE_VCD = ");
         of.puts(v3Global.opt.traceEnabledVcd() ? "1" : "0");
@@ -858,9 +863,10 @@ class EmitMkHierVerilation final {
         // Instead of direct execute of "cd $(VM_HIER_RUN_DIR) && $(VM_HIER_VERILATOR)",
         // call via make to get message of "Entering directory" and "Leaving directory".
         // This will make some editors and IDEs happy when viewing a logfile.
+        // '+' passes the make jobserver down, so Verilator can take job slots for its threads.
         of.puts("# VM_HIER_LAUNCH_VERILATOR_ARGSFILE must be passed as a command argument\n");
         of.puts("hier_launch_verilator:\n");
-        of.puts("\t$(VM_HIER_VERILATOR) -f $(VM_HIER_LAUNCH_VERILATOR_ARGSFILE)\n");
+        of.puts("\t+$(VM_HIER_VERILATOR) -f $(VM_HIER_LAUNCH_VERILATOR_ARGSFILE)\n");
 
         // Top level module
         {
@@ -99,6 +99,7 @@ class V3EmitMkJsonEmitter final {
             .put("trace", v3Global.opt.trace())
             .put("trace_fst", v3Global.opt.traceEnabledFst())
             .put("trace_saif", v3Global.opt.traceEnabledSaif())
+            .put("trace_vbt", v3Global.opt.traceEnabledVbt())
             .put("trace_vcd", v3Global.opt.traceEnabledVcd())
             .end()
             .begin("sources")
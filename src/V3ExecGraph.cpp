@@ -899,6 +899,20 @@ void finalizeCosts(V3Graph* execMTaskGraphp) {
     }
 }
 
+// Create the state variable tracking the upstream dependencies of an mtask, returns its name
+string createMTaskStateVar(const ExecMTask* mtaskp, uint32_t nDependencies) {
+    AstNodeModule* const modp = v3Global.rootp()->topModulep();
+    FileLine* const fl = modp->fileline();
+    const string name = "__Vm_mtaskstate_" + cvtToStr(mtaskp->id());
+    AstBasicDType* const s_mtaskStateDtypep
+        = v3Global.rootp()->typeTablep()->findBasicDType(fl, VBasicDTypeKwd::MTASKSTATE);
+    AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, name, s_mtaskStateDtypep};
+    varp->valuep(new AstConst{fl, nDependencies});
+    varp->protect(false);  // Do not protect as we have references in text
+    modp->addStmtsp(varp);
+    return name;
+}
+
 void addMTaskToFunction(const ThreadSchedule& schedule, const uint32_t threadId, AstCFunc* funcp,
                         const ExecMTask* mtaskp) {
     AstScope* const scopep = v3Global.rootp()->topScopep()->scopep();
@@ -913,13 +927,7 @@ void addMTaskToFunction(const ThreadSchedule& schedule, const uint32_t threadId,
     if (const uint32_t nDependencies = schedule.crossThreadDependencies(mtaskp)) {
         // This mtask has dependencies executed on another thread, so it may block. Create the task
         // state variable and wait to be notified.
-        const string name = "__Vm_mtaskstate_" + cvtToStr(mtaskp->id());
-        AstBasicDType* const s_mtaskStateDtypep
-            = v3Global.rootp()->typeTablep()->findBasicDType(fl, VBasicDTypeKwd::MTASKSTATE);
-        AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP, name, s_mtaskStateDtypep};
-        varp->valuep(new AstConst{fl, nDependencies});
-        varp->protect(false);  // Do not protect as we have references in text
-        modp->addStmtsp(varp);
+        const string name = createMTaskStateVar(mtaskp, nDependencies);
         // For now, reference is still via text bashing
         if (v3Global.opt.profExec()) {
             addCStmt("VL_EXEC_TRACE_ADD_RECORD(vlSymsp).threadScheduleWaitBegin();");
@@ -1005,6 +1013,131 @@ const std::vector<AstCFunc*> createThreadFunctions(const ThreadSchedule& schedul
     return funcps;
 }
 
+// With --threads-schedule dynamic, create a single function that is run by each thread of the
+// schedule. Rather than executing a fixed sequence of mtasks, the threads pull mtasks from a
+// shared queue as their upstream dependencies complete, so a thread finishing early picks up
+// work a slower thread would otherwise have had to do. The static schedule only determines the
+// number of threads, and mtasks with higher priority are made ready first.
+const std::vector<AstCFunc*> createDynamicThreadFunctions(AstExecGraph* const execGraphp,
+                                                          const ThreadSchedule& schedule) {
+    AstScope* const scopep = v3Global.rootp()->topScopep()->scopep();
+    AstNodeModule* const modp = v3Global.rootp()->topModulep();
+    FileLine* const fl = modp->fileline();
+    const string& tag = execGraphp->name();
+    const string queue = "vlSymsp->__Vm_mtaskready__" + tag;
+
+    // Number the mtasks in priority order, this is the order roots are pushed to the queue
+    std::vector<const ExecMTask*> mtasks;
+    uint32_t nThreads = 0;
+    for (const std::vector<const ExecMTask*>& thread : schedule.m_threads) {
+        if (thread.empty()) continue;
+        ++nThreads;
+        mtasks.insert(mtasks.end(), thread.begin(), thread.end());
+    }
+    const auto priorityCmp = [](const ExecMTask* ap, const ExecMTask* bp) {
+        if (ap->priority() != bp->priority()) return ap->priority() > bp->priority();
+        return ap->id() < bp->id();
+    };
+    std::sort(mtasks.begin(), mtasks.end(), priorityCmp);
+    std::unordered_map<const ExecMTask*, uint32_t> indexes;
+    for (const ExecMTask* const mtaskp : mtasks) indexes.emplace(mtaskp, indexes.size());
+
+    const string name{"__Vthread__" + tag + "__s" + cvtToStr(schedule.id()) + "__dynamic"};
+    AstCFunc* const funcp = new AstCFunc{fl, name, nullptr, "void"};
+    modp->addStmtsp(funcp);
+    funcp->isStatic(true);  // Uses void self pointer, so static and hand rolled
+    funcp->isLoose(true);
+    funcp->entryPoint(true);
+    funcp->argTypes("void* voidSelf, bool even_cycle");
+
+    // Helper function to make the code a bit more legible
+    const auto addCStmt = [=](const string& stmt) -> void {  //
+        funcp->addStmtsp(new AstCStmt{fl, stmt});
+    };
+
+    // Setup vlSelf and vlSyms
+    addCStmt(EmitCUtil::voidSelfAssign(modp));
+    addCStmt(EmitCUtil::symClassAssign());
+
+    // Statements to make the roots ready, executed before starting the threads
+    std::vector<string> startStmts;
+    startStmts.emplace_back(queue + ".start(" + cvtToStr(mtasks.size()) + ");");
+
+    addCStmt("for (uint32_t mtask; (mtask = " + queue
+             + ".pop()) != VlMTaskReadyQueue::DONE;) {");
+    addCStmt("switch (mtask) {");
+    for (const ExecMTask* const mtaskp : mtasks) {
+        addCStmt("case " + cvtToStr(indexes.at(mtaskp)) + ": {");
+
+        uint32_t nDependencies = 0;
+        for (const V3GraphEdge& edge : mtaskp->inEdges()) {
+            if (schedule.contains(edge.fromp()->as<ExecMTask>())) ++nDependencies;
+        }
+        if (nDependencies) {
+            // The mtask is only pushed once ready, so this does not block, but is required to
+            // synchronize with all upstream mtasks, not just the one that pushed it
+            const string stateName = createMTaskStateVar(mtaskp, nDependencies);
+            addCStmt("vlSelf->" + stateName + ".waitUntilUpstreamDone(even_cycle);");
+        } else {
+            startStmts.emplace_back(queue + ".push(" + cvtToStr(indexes.at(mtaskp)) + ");");
+        }
+
+        if (v3Global.opt.profPgo()) {
+            // No lock around startCounter, as counter numbers are unique per mtask
+            addCStmt("vlSymsp->_vm_pgoProfiler.startCounter(" + std::to_string(mtaskp->id())
+                     + ");");
+        }
+
+        // Call the MTask function
+        AstCCall* const callp = new AstCCall{fl, mtaskp->funcp()};
+        callp->selfPointer(VSelfPointerText{VSelfPointerText::VlSyms{}, scopep->nameDotless()});
+        callp->dtypeSetVoid();
+        funcp->addStmtsp(callp->makeStmt());
+
+        if (v3Global.opt.profPgo()) {
+            addCStmt("vlSymsp->_vm_pgoProfiler.stopCounter(" + std::to_string(mtaskp->id())
+                     + ");");
+        }
+
+        // Signal each dependent mtask, whichever completes its dependencies makes it ready
+        std::vector<const ExecMTask*> nexts;
+        for (const V3GraphEdge& edge : mtaskp->outEdges()) {
+            const ExecMTask* const nextp = edge.top()->as<ExecMTask>();
+            if (schedule.contains(nextp)) nexts.push_back(nextp);
+        }
+        std::sort(nexts.begin(), nexts.end(), priorityCmp);
+        for (const ExecMTask* const nextp : nexts) {
+            addCStmt("if (vlSelf->__Vm_mtaskstate_" + cvtToStr(nextp->id())
+                     + ".signalUpstreamDone(even_cycle)) " + queue + ".push("
+                     + cvtToStr(indexes.at(nextp)) + ");");
+        }
+        addCStmt("break;\n}");
+    }
+    addCStmt("default: break;\n}\n}");
+
+    // Unblock the fake "final" mtask when this thread is finished
+    addCStmt("vlSelf->__Vm_mtaskstate_final__" + cvtToStr(schedule.id()) + tag
+             + ".signalUpstreamDone(even_cycle);");
+
+    // Create the fake "final" mtask state variable
+    AstBasicDType* const s_mtaskStateDtypep
+        = v3Global.rootp()->typeTablep()->findBasicDType(fl, VBasicDTypeKwd::MTASKSTATE);
+    AstVar* const varp = new AstVar{fl, VVarType::MODULETEMP,
+                                    "__Vm_mtaskstate_final__" + cvtToStr(schedule.id()) + tag,
+                                    s_mtaskStateDtypep};
+    varp->valuep(new AstConst(fl, nThreads));
+    varp->protect(false);  // Do not protect as we have references in text
+    modp->addStmtsp(varp);
+
+    // Make the roots ready before the threads are started
+    for (const string& stmt : startStmts) execGraphp->addStmtsp(new AstCStmt{fl, stmt});
+
+    V3Stats::addStatSum("Optimizations, Thread schedule dynamic tasks", mtasks.size());
+
+    // Each thread runs the same function
+    return std::vector<AstCFunc*>(nThreads, funcp);
+}
+
 void addThreadStartWrapper(AstExecGraph* const execGraphp) {
     // FileLine used for constructing nodes below
     FileLine* const fl = v3Global.rootp()->fileline();
@@ -1130,8 +1263,12 @@ void implementExecGraph(AstExecGraph* const execGraphp, const ThreadSchedule& sc
     // Nothing to be done if there are no MTasks in the graph at all.
     if (execGraphp->depGraphp()->empty()) return;
 
-    // Create a function to be run by each thread.
-    const std::vector<AstCFunc*>& funcps = createThreadFunctions(schedule, execGraphp->name());
+    // Create a function to be run by each thread. Dynamic scheduling is not used with
+    // hierarchical blocks, as those reserve threads for the hierarchical children.
+    const std::vector<AstCFunc*>& funcps
+        = v3Global.opt.threadsDynamic() && v3Global.opt.hierBlocks().empty()
+              ? createDynamicThreadFunctions(execGraphp, schedule)
+              : createThreadFunctions(schedule, execGraphp->name());
     UASSERT(!funcps.empty(), "Non-empty ExecGraph yields no threads?");
 
     // Start the thread functions at the point this AstExecGraph is located in the tree.
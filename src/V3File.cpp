@@ -986,16 +986,66 @@ V3OutFile::V3OutFile(const string& filename, V3OutFormatter::Language lang)
     : V3OutFormatter{lang}
     , m_filename{filename}
     , m_bufferp{new std::array<char, WRITE_BUFFER_SIZE_BYTES>{}} {
-    if ((m_fp = V3File::new_fopen_w(filename)) == nullptr) {
-        v3fatal("Can't write file: " << filename);
+    if (lang == LA_C && v3Global.opt.outputKeepUnchanged()
+        && V3Options::fileStatNormal(filename)) {
+        // Write to a temporary, and only replace the original if contents differ,
+        // so unchanged files keep their timestamp and are not recompiled
+        m_tmpFilename = filename + ".tmp";
+        V3File::createMakeDirFor(filename);
+        V3File::addTgtDepend(filename);
+        m_fp = fopen(m_tmpFilename.c_str(), "w");
+    } else {
+        m_fp = V3File::new_fopen_w(filename);
     }
+    if (!m_fp) v3fatal("Can't write file: " << filename);
 }
 
-V3OutFile::~V3OutFile() {
-    writeBlock();
+static bool sameFileContents(const string& filenamea, const string& filenameb) {
+    const std::unique_ptr<std::ifstream> ifap{V3File::new_ifstream_nodepend(filenamea)};
+    const std::unique_ptr<std::ifstream> ifbp{V3File::new_ifstream_nodepend(filenameb)};
+    if (ifap->fail() || ifbp->fail()) return false;
+    std::array<char, 64 * 1024> bufa;
+    std::array<char, 64 * 1024> bufb;
+    while (true) {
+        ifap->read(bufa.data(), bufa.size());
+        ifbp->read(bufb.data(), bufb.size());
+        const std::streamsize counta = ifap->gcount();
+        if (counta != ifbp->gcount()) return false;
+        if (std::memcmp(bufa.data(), bufb.data(), counta)) return false;
+        if (counta == 0 || ifap->eof() || ifbp->eof()) return ifap->eof() && ifbp->eof();
+    }
+}
 
-    if (m_fp) fclose(m_fp);
+void V3OutFile::close() {
+    if (!m_fp) return;
+    writeBlock();
+    fclose(m_fp);
     m_fp = nullptr;
+
+    if (!m_tmpFilename.empty()) {
+        const string tmpFilename = m_tmpFilename;
+        m_tmpFilename.clear();
+        if (sameFileContents(tmpFilename, m_filename)) {
+            std::remove(tmpFilename.c_str());
+            V3Stats::addStatSum("Output, C++ files unchanged", 1);
+        } else {
+            std::remove(m_filename.c_str());  // Required before rename on Windows
+            if (std::rename(tmpFilename.c_str(), m_filename.c_str()) != 0) {
+                v3fatal("Can't write file: " << m_filename);
+            }
+        }
+    }
+}
+
+V3OutFile::~V3OutFile() {
+    // Only cleanup here, errors are reported by close()
+    if (m_fp) {
+        writeBlock();
+        fclose(m_fp);
+        m_fp = nullptr;
+    }
+    // Not closed, e.g. unwinding after an error, so leave the original alone
+    if (!m_tmpFilename.empty()) std::remove(m_tmpFilename.c_str());
 }
 
 void V3OutFile::putsForceIncs() {
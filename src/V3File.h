@@ -197,6 +197,7 @@ class V3OutFile VL_NOT_FINAL : public V3OutFormatter {
 
     // MEMBERS
     const std::string m_filename;
+    std::string m_tmpFilename;  // If non-empty, file being written, to replace m_filename
     FILE* m_fp = nullptr;
     std::size_t m_usedBytes = 0;  // Number of bytes stored in m_bufferp
     std::size_t m_writtenBytes = 0;  // Number of bytes written to output
@@ -211,6 +212,10 @@ public:
     ~V3OutFile() override;
 
     std::string filename() const { return m_filename; }
+    // Flush and close the file. With --output-keep-unchanged, also replace the
+    // original only if the contents differ. Must be called before destruction
+    // for the output to be kept.
+    void close();
 
     void putsForceIncs();
 
@@ -35,6 +35,9 @@
 
 #include "V3Global.h"
 #include "V3Stats.h"
+#include "V3ThreadPool.h"
+
+#include <vector>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -175,7 +178,11 @@ struct FuncOptStats final {
     VDouble0 m_concatSplits;  // Number of splits in assignments with Concat on RHS
 
     FuncOptStats() = default;
-    ~FuncOptStats() {
+    void addTo(FuncOptStats& total) const {
+        total.m_balancedConcats += m_balancedConcats;
+        total.m_concatSplits += m_concatSplits;
+    }
+    void addStats() const {
         V3Stats::addStat("Optimizations, FuncOpt concat trees balanced", m_balancedConcats);
         V3Stats::addStat("Optimizations, FuncOpt concat splits", m_concatSplits);
     }
@@ -333,15 +340,28 @@ void V3FuncOpt::funcOptAll(AstNetlist* nodep) {
     UINFO(2, __FUNCTION__ << ":");
     {
         const VNUser1InUse user1InUse;
-        FuncOptStats stats;
+        // Functions are optimized independently, so process them in parallel,
+        // each job keeping its own statistics that are combined afterwards
+        std::vector<AstCFunc*> funcps;
         for (AstNodeModule* modp = nodep->modulesp(); modp;
              modp = VN_AS(modp->nextp(), NodeModule)) {
             for (AstNode* stmtp = modp->stmtsp(); stmtp; stmtp = stmtp->nextp()) {
-                if (AstCFunc* const cfuncp = VN_CAST(stmtp, CFunc)) {
-                    FuncOptVisitor::apply(stats, cfuncp);
-                }
+                if (AstCFunc* const cfuncp = VN_CAST(stmtp, CFunc)) funcps.push_back(cfuncp);
+            }
+        }
+        std::vector<FuncOptStats> stats(funcps.size());
+        {
+            V3ThreadScope threadScope;
+            for (size_t i = 0; i < funcps.size(); ++i) {
+                AstCFunc* const cfuncp = funcps[i];
+                FuncOptStats& statsr = stats[i];
+                threadScope.enqueue(
+                    [cfuncp, &statsr]() { FuncOptVisitor::apply(statsr, cfuncp); });
             }
         }
+        FuncOptStats total;
+        for (const FuncOptStats& funcStats : stats) funcStats.addTo(total);
+        total.addStats();
     }
     V3Global::dumpCheckGlobalTree("funcopt", 0, dumpTreeEitherLevel() >= 3);
 }
@@ -20,6 +20,7 @@
 #include "config_build.h"
 #include "verilatedos.h"
 
+#include "V3Allocator.h"
 #include "V3Error.h"
 #include "V3List.h"
 #include "V3Rtti.h"
@@ -134,6 +135,8 @@ public:
         return new V3GraphEdge{graphp, fromp, top, *this};
     }
     virtual ~V3GraphEdge() = default;
+    static void* operator new(size_t size) { return V3Allocator::allocate(size); }
+    static void operator delete(void* objp, size_t size) { V3Allocator::deallocate(objp, size); }
     // METHODS
     // Return true iff of type T
     template <typename T>
@@ -232,6 +235,8 @@ public:
         return new V3GraphVertex{graphp, *this};
     }
     virtual ~V3GraphVertex() = default;
+    static void* operator new(size_t size) { return V3Allocator::allocate(size); }
+    static void operator delete(void* objp, size_t size) { V3Allocator::deallocate(objp, size); }
     void unlinkEdges(V3Graph* graphp) VL_MT_DISABLED;
     void unlinkDelete(V3Graph* graphp) VL_MT_DISABLED;
 
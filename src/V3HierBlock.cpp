@@ -261,6 +261,8 @@ void V3HierBlock::writeCommandArgsFile(bool forMkJson) const {
     V3HierWriteCommonInputs(this, of.get(), forMkJson);
     const VStringList& commandOpts = commandArgs(false);
     for (const string& opt : commandOpts) *of << opt << "\n";
+    // -j is not passed down, but threads beyond the first are limited by the make jobserver
+    if (!forMkJson) *of << "--verilate-jobs " << cvtToStr(v3Global.opt.verilateJobs()) << "\n";
     *of << hierBlockArgs().front() << "\n";
     for (const V3GraphEdge& edge : outEdges()) {
         const V3HierBlock* const dependencyp = edge.top()->as<V3HierBlock>();
@@ -430,6 +432,7 @@ void V3HierGraph::writeCommandArgsFiles(bool forMkJson) const {
         *of << "--protect-key " << v3Global.opt.protectKeyDefaulted() << "\n";
     }
     *of << "--threads " << cvtToStr(v3Global.opt.threads()) << "\n";
+    if (!forMkJson) *of << "--verilate-jobs " << cvtToStr(v3Global.opt.verilateJobs()) << "\n";
     *of << (v3Global.opt.systemC() ? "--sc" : "--cc") << "\n";
     *of << v3Global.opt.allArgsStringForHierBlock(true) << "\n";
 }
@@ -0,0 +1,170 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: GNU Make jobserver client
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// The jobserver is named in MAKEFLAGS, either as '--jobserver-auth=fifo:PATH'
+// (GNU Make 4.4+), or as a pipe's '--jobserver-auth=R,W' (or
+// '--jobserver-fds=R,W' before GNU Make 4.2) file descriptors. Each byte read
+// from it is one job slot, and the same byte must be written back when done.
+//
+// Tokens are only ever taken without blocking. Waiting for a slot while
+// holding the implicit one could deadlock when all jobs do the same. A pipe
+// is shared with make, so it can't be made non-blocking in place; it is
+// reopened through /proc on Linux. The jobserver is only available when its
+// descriptors are open in this process; make closes them for recipes not
+// marked recursive with '+', even though MAKEFLAGS still names them.
+//*************************************************************************
+
+#define VL_MT_DISABLED_CODE_UNIT 1
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+#include "V3JobServer.h"
+
+#include "V3Global.h"
+#include "V3String.h"
+
+#include <cstdio>
+#include <cstring>
+
+// clang-format off
+#if !defined(_WIN32) && !defined(__MINGW32__)
+# define VL_JOBSERVER_POSIX
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+// clang-format on
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+
+class V3JobServerImp final {
+    // MEMBERS
+    bool m_parsed = false;  // Parsed MAKEFLAGS
+    bool m_named = false;  // MAKEFLAGS names a jobserver
+    int m_readFd = -1;  // Non-blocking descriptor to take tokens from, owned
+    int m_writeFd = -1;  // Descriptor to return tokens to
+    bool m_ownWriteFd = false;  // m_writeFd was opened here, not inherited from make
+    string m_tokens;  // Tokens taken, returned exactly as read
+
+    // METHODS
+    void closeFds() {
+#ifdef VL_JOBSERVER_POSIX
+        if (m_readFd >= 0) ::close(m_readFd);
+        if (m_ownWriteFd && m_writeFd >= 0) ::close(m_writeFd);
+#endif
+        m_readFd = -1;
+        m_writeFd = -1;
+        m_ownWriteFd = false;
+    }
+    void parse() {
+        if (m_parsed) return;
+        m_parsed = true;
+#ifdef VL_JOBSERVER_POSIX
+        const string flags = V3Options::getenvMAKEFLAGS();
+        string auth;
+        for (const char* const keyp : {"--jobserver-auth=", "--jobserver-fds="}) {
+            const size_t pos = flags.rfind(keyp);
+            if (pos == string::npos) continue;
+            const size_t start = pos + std::strlen(keyp);
+            auth = flags.substr(start, flags.find(' ', start) - start);
+            break;
+        }
+        if (auth.empty()) return;
+        m_named = true;
+        UINFO(3, "Jobserver: " << auth);
+        if (VString::startsWith(auth, "fifo:")) {
+            const string path = auth.substr(std::strlen("fifo:"));
+            m_readFd = ::open(path.c_str(), O_RDONLY | O_NONBLOCK);
+            m_writeFd = ::open(path.c_str(), O_WRONLY);
+            m_ownWriteFd = true;
+        } else {
+            int readFd = -1;
+            int writeFd = -1;
+            // Descriptors are only passed down to recursive make commands
+            if (std::sscanf(auth.c_str(), "%d,%d", &readFd, &writeFd) == 2 && readFd >= 0
+                && writeFd >= 0 && ::fcntl(readFd, F_GETFD) >= 0
+                && ::fcntl(writeFd, F_GETFD) >= 0) {
+#ifdef __linux__
+                // Reopen the pipe, so it can be made non-blocking without affecting make
+                const string procPath = "/proc/self/fd/" + std::to_string(readFd);
+                m_readFd = ::open(procPath.c_str(), O_RDONLY | O_NONBLOCK);
+                m_writeFd = writeFd;
+#endif
+            }
+        }
+        if (m_readFd < 0 || m_writeFd < 0) {
+            UINFO(1, "Jobserver: Not usable from this process");
+            closeFds();
+        }
+#endif
+    }
+
+public:
+    // CONSTRUCTORS
+    V3JobServerImp() = default;
+    ~V3JobServerImp() {
+        // Also reached on exit after an error, when make still expects the slots back
+        release();
+        closeFds();
+    }
+    VL_UNCOPYABLE(V3JobServerImp);
+
+    // METHODS
+    bool named() {
+        parse();
+        return m_named;
+    }
+    bool available() {
+        parse();
+        return m_readFd >= 0 && m_writeFd >= 0;
+    }
+    int acquire(int count) {
+        if (!available()) return 0;
+#ifdef VL_JOBSERVER_POSIX
+        for (; count > 0; --count) {
+            char token;
+            if (::read(m_readFd, &token, 1) != 1) break;  // EAGAIN: No slot free now
+            m_tokens += token;
+        }
+#endif
+        UINFO(1, "Jobserver: Holding " << m_tokens.size() << " additional job slots");
+        return static_cast<int>(m_tokens.size());
+    }
+    void release() {
+        if (m_tokens.empty()) return;
+#ifdef VL_JOBSERVER_POSIX
+        size_t written = 0;
+        while (written < m_tokens.size()) {
+            const ssize_t got
+                = ::write(m_writeFd, m_tokens.data() + written, m_tokens.size() - written);
+            if (got <= 0) break;
+            written += got;
+        }
+#endif
+        m_tokens.clear();
+    }
+};
+
+static V3JobServerImp s_jobServer;
+
+//######################################################################
+// V3JobServer
+
+bool V3JobServer::named() { return s_jobServer.named(); }
+bool V3JobServer::available() { return s_jobServer.available(); }
+int V3JobServer::acquire(int count) { return s_jobServer.acquire(count); }
+void V3JobServer::release() { s_jobServer.release(); }
@@ -0,0 +1,42 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: GNU Make jobserver client
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#ifndef VERILATOR_V3JOBSERVER_H_
+#define VERILATOR_V3JOBSERVER_H_
+
+#include "config_build.h"
+#include "verilatedos.h"
+
+//============================================================================
+// When Verilator is run from a parallel make (e.g. the hierarchical
+// Verilation rules in {prefix}_hier.mk), each process already holds one
+// implicit job slot. Additional Verilation threads take slots from the
+// jobserver, so concurrent Verilations together use no more than 'make -j'.
+
+class V3JobServer final {
+public:
+    // Return true if MAKEFLAGS names a jobserver, whether or not it is usable
+    static bool named() VL_MT_DISABLED;
+    // Return true if MAKEFLAGS names a jobserver whose descriptors are open
+    // in this process, so job slots must be acquired
+    static bool available() VL_MT_DISABLED;
+    // Take up to 'count' additional job slots without waiting, return number taken
+    static int acquire(int count) VL_MT_DISABLED;
+    // Return all slots taken by acquire()
+    static void release() VL_MT_DISABLED;
+};
+
+#endif  // Guard
@@ -501,6 +501,7 @@ std::vector<std::string> V3Options::traceClassBases() const VL_MT_SAFE {
     std::vector<std::string> result;
     if (traceEnabledFst()) result.emplace_back("VerilatedFst");
     if (traceEnabledSaif()) result.emplace_back("VerilatedSaif");
+    if (traceEnabledVbt()) result.emplace_back("VerilatedVbt");
     if (traceEnabledVcd()) result.emplace_back("VerilatedVcd");
     return result;
 }
@@ -514,6 +515,7 @@ std::vector<std::string> V3Options::traceSourceBases() const VL_MT_SAFE {
     std::vector<std::string> result;
     if (traceEnabledFst()) result.emplace_back("verilated_fst");
     if (traceEnabledSaif()) result.emplace_back("verilated_saif");
+    if (traceEnabledVbt()) result.emplace_back("verilated_vbt");
     if (traceEnabledVcd()) result.emplace_back("verilated_vcd");
     return result;
 }
@@ -996,13 +998,18 @@ void V3Options::notify() VL_MT_DISABLED {
         m_main = false;
     }
 
-    if (trace() && !traceEnabledFst() && !traceEnabledSaif() && !traceEnabledVcd()) {
+    if (trace() && !traceEnabledFst() && !traceEnabledSaif() && !traceEnabledVbt()
+        && !traceEnabledVcd()) {
         m_traceEnabledVcd = true;  // No format, with --trace means wanted --trace-vcd
     }
-    if (traceEnabledFst() || traceEnabledSaif() || traceEnabledVcd()) m_trace = true;
-    const int ntraces = traceEnabledFst() + traceEnabledSaif() + traceEnabledVcd();
+    if (traceEnabledFst() || traceEnabledSaif() || traceEnabledVbt() || traceEnabledVcd()) {
+        m_trace = true;
+    }
+    const int ntraces
+        = traceEnabledFst() + traceEnabledSaif() + traceEnabledVbt() + traceEnabledVcd();
     if (ntraces > 1)  // Issue #5813
-        cmdfl->v3error("Only one of --trace-fst, --trace-saif or --trace--vcd may be used");
+        cmdfl->v3error(
+            "Only one of --trace-fst, --trace-saif, --trace-vbt or --trace--vcd may be used");
 
     if (protectIds()) {
         if (allPublic()) {
@@ -1043,6 +1050,9 @@ void V3Options::notify() VL_MT_DISABLED {
         && (v3Global.opt.jsonOnly() || v3Global.opt.lintOnly() || v3Global.opt.xmlOnly()))
         v3Global.opt.m_timing.setTrueOrFalse(true);
 
+    // The work queue is selected when compiling the runtime library
+    if (m_threadsQueueLockFree) addCFlags("-DVL_THREADS_LOCKFREE=1");
+
     if (trace()) {
         // With --trace-vcd, --trace-threads is ignored
         if (traceEnabledVcd()) m_traceThreads = 1;
@@ -1616,6 +1626,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_outputGroups = std::atoi(valp);
         if (m_outputGroups < -1) fl->v3error("--output-groups must be >= -1: " << valp);
     });
+    DECL_OPTION("-output-keep-unchanged", OnOff, &m_outputKeepUnchanged);
     DECL_OPTION("-output-split", Set, &m_outputSplit);
     DECL_OPTION("-output-split-cfuncs", CbVal, [this, fl](const char* valp) {
         m_outputSplitCFuncs = std::atoi(valp);
@@ -1666,6 +1677,21 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-prof-cfuncs", CbCall, [this]() { m_profC = m_profCFuncs = true; });
     DECL_OPTION("-prof-exec", OnOff, &m_profExec);
     DECL_OPTION("-prof-pgo", OnOff, &m_profPgo);
+    DECL_OPTION("-prof-pgo-loop", CbVal, [](const char*) {});  // Processed only in bin/verilator
+    DECL_OPTION("-prof-pgo-merge", CbVal, [this, fl](const char* valp) {
+        const string mode = valp;
+        const bool percentile = mode.size() > 1 && mode[0] == 'p'
+                                && mode.find_first_not_of("0123456789", 1) == string::npos
+                                && std::atoi(valp + 1) <= 100;
+        if (mode == "sum" || mode == "mean" || mode == "max" || percentile) {
+            m_profPgoMerge = mode;
+        } else {
+            fl->v3error("Unknown setting for --prof-pgo-merge: '"
+                        << valp << "'\n"
+                        << fl->warnMore() << "... Suggest 'sum', 'mean', 'max', or 'p<percentile>'");
+        }
+    });
+    DECL_OPTION("-prof-pgo-run", CbVal, [](const char*) {});  // Processed only in bin/verilator
     DECL_OPTION("-profile-cfuncs", CbCall, [this]() {
         m_profC = m_profCFuncs = true;
     }).undocumented();  // Renamed
@@ -1774,6 +1800,28 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         m_threadsMaxMTasks = std::atoi(valp);
         if (m_threadsMaxMTasks < 1) fl->v3fatal("--threads-max-mtasks must be >= 1: " << valp);
     });
+    DECL_OPTION("-threads-queue", CbVal, [this, fl](const char* valp) {
+        if (!std::strcmp(valp, "lockfree")) {
+            m_threadsQueueLockFree = true;
+        } else if (!std::strcmp(valp, "mutex")) {
+            m_threadsQueueLockFree = false;
+        } else {
+            fl->v3error("Unknown setting for --threads-queue: '"
+                        << valp << "'\n"
+                        << fl->warnMore() << "... Suggest 'lockfree' or 'mutex'");
+        }
+    });
+    DECL_OPTION("-threads-schedule", CbVal, [this, fl](const char* valp) {
+        if (!std::strcmp(valp, "dynamic")) {
+            m_threadsDynamic = true;
+        } else if (!std::strcmp(valp, "static")) {
+            m_threadsDynamic = false;
+        } else {
+            fl->v3error("Unknown setting for --threads-schedule: '"
+                        << valp << "'\n"
+                        << fl->warnMore() << "... Suggest 'dynamic' or 'static'");
+        }
+    });
     DECL_OPTION("-timescale", CbVal, [this, fl](const char* valp) {
         VTimescale unit;
         VTimescale prec;
@@ -1815,6 +1863,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     DECL_OPTION("-trace-max-array", Set, &m_traceMaxArray);
     DECL_OPTION("-trace-max-width", Set, &m_traceMaxWidth);
     DECL_OPTION("-trace-params", OnOff, &m_traceParams);
+    DECL_OPTION("-trace-share", OnOff, &m_traceShare);
     DECL_OPTION("-trace-structs", OnOff, &m_traceStructs);
     DECL_OPTION("-trace-threads", CbVal, [this, fl](const char* valp) {
         m_trace = true;
@@ -1823,6 +1872,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
     });
     DECL_OPTION("-no-trace-top", Set, &m_noTraceTop);
     DECL_OPTION("-trace-underscore", OnOff, &m_traceUnderscore);
+    DECL_OPTION("-trace-vbt", CbCall, [this]() { m_traceEnabledVbt = true; });
     DECL_OPTION("-trace-vcd", CbCall, [this]() { m_traceEnabledVcd = true; });
 
     DECL_OPTION("-U", CbPartialMatch, &V3PreShell::undef);
@@ -1858,6 +1908,7 @@ void V3Options::parseOptsList(FileLine* fl, const string& optdir, int argc,
         v3Global.vlExit(0);
     });
     DECL_OPTION("-vpi", OnOff, &m_vpi);
+    DECL_OPTION("-vpi-dirty", OnOff, &m_vpiDirty);
 
     DECL_OPTION("-Wall", CbCall, []() {
         FileLine::globalWarnLintOff(false);
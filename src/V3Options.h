@@ -263,6 +263,7 @@ private:
     bool m_makeJson = false;        // main switch: --make json
     bool m_main = false;            // main switch: --main
     bool m_outFormatOk = false;     // main switch: --cc, --sc or --sp was specified
+    bool m_outputKeepUnchanged = false;  // main switch: --output-keep-unchanged
     bool m_pedantic = false;        // main switch: --Wpedantic
     bool m_pinsInoutEnables = false;// main switch: --pins-inout-enables
     bool m_pinsScUint = false;      // main switch: --pins-sc-uint
@@ -295,19 +296,24 @@ private:
     bool m_threadsCoarsen = true;   // main switch: --threads-coarsen
     bool m_threadsDpiPure = true;   // main switch: --threads-dpi all/pure
     bool m_threadsDpiUnpure = false;  // main switch: --threads-dpi all
+    bool m_threadsQueueLockFree = false;  // main switch: --threads-queue lockfree
+    bool m_threadsDynamic = false;  // main switch: --threads-schedule dynamic
     VOptionBool m_timing;           // main switch: --timing
     bool m_trace = false;           // main switch: --trace
     bool m_traceCoverage = false;   // main switch: --trace-coverage
     bool m_traceEnabledFst = false;  // main switch: --trace-fst
     bool m_traceEnabledSaif = false;  // main switch: --trace-saif
+    bool m_traceEnabledVbt = false;  // main switch: --trace-vbt
     bool m_traceEnabledVcd = false;  // main switch: --trace-vcd
     bool m_traceParams = true;      // main switch: --trace-params
+    bool m_traceShare = false;      // main switch: --trace-share
     bool m_traceStructs = false;    // main switch: --trace-structs
     bool m_noTraceTop = false;      // main switch: --no-trace-top
     bool m_traceUnderscore = false; // main switch: --trace-underscore
     bool m_underlineZero = false;   // main switch: --underline-zero; undocumented old Verilator 2
     bool m_verilate = true;         // main switch: --verilate
     bool m_vpi = false;             // main switch: --vpi
+    bool m_vpiDirty = false;        // main switch: --vpi-dirty
     bool m_waiverMultiline = false;  // main switch: --waiver-multiline
     bool m_xInitialEdge = false;    // main switch: --x-initial-edge
     bool m_xmlOnly = false;         // main switch: --xml-only
@@ -373,6 +379,7 @@ private:
     string      m_modPrefix;    // main switch: --mod-prefix
     string      m_pipeFilter;   // main switch: --pipe-filter
     string      m_prefix;       // main switch: --prefix
+    string      m_profPgoMerge = "sum";  // main switch: --prof-pgo-merge
     string      m_protectKey;   // main switch: --protect-key
     string      m_topModule;    // main switch: --top-module
     string      m_unusedRegexp; // main switch: --unused-regexp
@@ -546,13 +553,17 @@ public:
     bool threadsDpiPure() const { return m_threadsDpiPure; }
     bool threadsDpiUnpure() const { return m_threadsDpiUnpure; }
     bool threadsCoarsen() const { return m_threadsCoarsen; }
+    bool threadsQueueLockFree() const { return m_threadsQueueLockFree; }
+    bool threadsDynamic() const { return m_threadsDynamic; }
     VOptionBool timing() const { return m_timing; }
     bool trace() const { return m_trace; }
     bool traceCoverage() const { return m_traceCoverage; }
     bool traceEnabledFst() const { return m_traceEnabledFst; }
     bool traceEnabledSaif() const { return m_traceEnabledSaif; }
+    bool traceEnabledVbt() const { return m_traceEnabledVbt; }
     bool traceEnabledVcd() const { return m_traceEnabledVcd; }
     bool traceParams() const { return m_traceParams; }
+    bool traceShare() const { return m_traceShare; }
     bool traceStructs() const { return m_traceStructs; }
     bool traceUnderscore() const { return m_traceUnderscore; }
     bool main() const { return m_main; }
@@ -571,6 +582,7 @@ public:
     bool profCFuncs() const { return m_profCFuncs; }
     bool profExec() const { return m_profExec; }
     bool profPgo() const { return m_profPgo; }
+    string profPgoMerge() const { return m_profPgoMerge; }
     bool usesProfiler() const { return profExec() || profPgo(); }
     bool protectIds() const VL_MT_SAFE { return m_protectIds; }
     bool allPublic() const { return m_public; }
@@ -587,6 +599,7 @@ public:
     bool reportUnoptflat() const { return m_reportUnoptflat; }
     bool verilate() const { return m_verilate; }
     bool vpi() const { return m_vpi; }
+    bool vpiDirty() const { return m_vpiDirty; }
     bool waiverMultiline() const { return m_waiverMultiline; }
     bool xInitialEdge() const { return m_xInitialEdge; }
     bool xmlOnly() const { return m_xmlOnly; }
@@ -615,6 +628,7 @@ public:
     int outputSplitCFuncs() const { return m_outputSplitCFuncs; }
     int outputSplitCTrace() const { return m_outputSplitCTrace; }
     int outputGroups() const { return m_outputGroups; }
+    bool outputKeepUnchanged() const VL_MT_SAFE { return m_outputKeepUnchanged; }
     int pinsBv() const VL_MT_SAFE { return m_pinsBv; }
     int reloopLimit() const { return m_reloopLimit; }
     VOptionBool skipIdentical() const { return m_skipIdentical; }
@@ -632,9 +646,20 @@ public:
     int traceMaxArray() const { return m_traceMaxArray; }
     int traceMaxWidth() const { return m_traceMaxWidth; }
     int traceThreads() const { return m_traceThreads; }
-    bool useTraceOffload() const { return trace() && traceEnabledFst() && traceThreads() > 1; }
+    bool useTraceOffload() const {
+        return trace() && (traceEnabledFst() || traceEnabledVbt()) && traceThreads() > 1
+               && !useTraceParallelFst();
+    }
+    // SAIF activity is accumulated by the generated code itself
+    bool useTraceToggle() const { return trace() && traceEnabledSaif(); }
     bool useTraceParallel() const {
-        return trace() && traceEnabledVcd() && (threads() > 1 || hierChild() > 1);
+        return trace()
+               && ((traceEnabledVcd() && (threads() > 1 || hierChild() > 1))
+                   || useTraceParallelFst());
+    }
+    // FST with more than 2 trace threads renders shards of the signals in parallel
+    bool useTraceParallelFst() const {
+        return trace() && traceEnabledFst() && traceThreads() > 2;
     }
     bool useFstWriterThread() const { return traceThreads() && traceEnabledFst(); }
     int unrollCount() const { return m_unrollCount; }
@@ -219,6 +219,10 @@ void V3Stats::statsStage(const string& name) {
     VlOs::memUsageBytes(memPeak /*ref*/, memCurrent /*ref*/);
     V3Stats::addStatPerf("Stage, Memory current (MB), " + digitName, memCurrent / 1024.0 / 1024.0);
     V3Stats::addStatPerf("Stage, Memory peak (MB), " + digitName, memPeak / 1024.0 / 1024.0);
+    V3Stats::addStatPerf("Stage, Node pool current (MB), " + digitName,
+                         V3Allocator::bytesCurrent() / 1024.0 / 1024.0);
+    V3Stats::addStatPerf("Stage, Node pool peak (MB), " + digitName,
+                         V3Allocator::bytesPeak() / 1024.0 / 1024.0);
 }
 
 void V3Stats::infoHeader(std::ofstream& os, const string& prefix) {
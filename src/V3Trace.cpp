@@ -45,7 +45,9 @@
 #include "V3Stats.h"
 
 #include <limits>
+#include <map>
 #include <set>
+#include <unordered_map>
 
 VL_DEFINE_DEBUG_FUNCTIONS;
 
@@ -184,20 +186,42 @@ class TraceVisitor final : public VNVisitor {
     TraceActivityVertex* const m_alwaysVtxp;  // "Always trace" vertex
     bool m_finding = false;  // Pass one of algorithm?
 
-    // Trace parallelism. Only VCD tracing can be parallelized at this time.
+    // Trace parallelism. Only VCD and FST tracing can be parallelized at this time.
     const uint32_t m_parallelism
-        = v3Global.opt.useTraceParallel() ? static_cast<uint32_t>(v3Global.opt.threads()) : 1;
+        = !v3Global.opt.useTraceParallel()   ? 1
+          : v3Global.opt.useTraceParallelFst() ? static_cast<uint32_t>(v3Global.opt.traceThreads())
+                                               : static_cast<uint32_t>(v3Global.opt.threads());
 
     VDouble0 m_statSetters;  // Statistic tracking
     VDouble0 m_statSettersSlow;  // Statistic tracking
     VDouble0 m_statUniqCodes;  // Statistic tracking
     VDouble0 m_statUniqSigs;  // Statistic tracking
+    VDouble0 m_statInstFuncs;  // Statistic tracking
 
     // All activity numbers applying to a given trace
     using ActCodeSet = std::set<uint32_t>;
     // For activity set, what traces apply
     using TraceVec = std::multimap<ActCodeSet, TraceTraceVertex*>;
 
+    // Canonical traces of values under the same scope, for --trace-share
+    struct TraceGroup final {
+        AstScope* const m_scopep;  // Scope holding the traced values
+        uint32_t m_baseCode = 0;  // First trace code of the group
+        // Activity set and vertex of each trace, in trace code order
+        std::vector<std::pair<const ActCodeSet*, TraceTraceVertex*>> m_traces;
+        explicit TraceGroup(AstScope* scopep)
+            : m_scopep{scopep} {}
+    };
+    std::vector<TraceGroup> m_groups;  // Trace groups, in trace code order
+
+    // Caller of shared trace functions of one type, for --trace-share
+    struct SharedCaller final {
+        AstCFunc* m_topFuncp = nullptr;  // Top function
+        AstCFunc* m_subFuncp = nullptr;  // Current sub function
+        uint32_t m_subFuncNum = 0;  // Number of sub functions created
+        int m_subStmts = 0;  // Size of current sub function
+    };
+
     // METHODS
 
     void detectDuplicates() {
@@ -483,6 +507,87 @@ class TraceVisitor final : public VNVisitor {
         }
     }
 
+    // The scope holding all values referenced by a trace, or the top scope if there are several
+    AstScope* traceScopep(const AstTraceDecl* declp) {
+        AstScope* scopep = nullptr;
+        const bool mixed = declp->valuep()->exists([&](const AstVarRef* refp) {
+            AstScope* const refScopep = refp->varScopep()->scopep();
+            if (scopep && scopep != refScopep) return true;
+            scopep = refScopep;
+            return false;
+        });
+        return mixed || !scopep ? m_topScopep : scopep;
+    }
+
+    void assignCodes(const TraceVec& traces) {
+        // Canonical traces in the order of their trace codes
+        std::vector<TraceTraceVertex*> vtxps;
+        if (!v3Global.opt.traceShare()) {
+            for (const auto& pair : traces) {
+                if (!pair.second->duplicatep()) vtxps.push_back(pair.second);
+            }
+        } else {
+            // Keep the traces under a scope together in declaration order, so the trace codes
+            // have the same layout relative to the first one in all instances of a module.
+            std::unordered_map<const TraceTraceVertex*, const ActCodeSet*> actSets;
+            for (const auto& pair : traces) actSets.emplace(pair.second, &pair.first);
+            std::unordered_map<const AstScope*, size_t> groupIndex;
+            for (V3GraphVertex& vtx : m_graph.vertices()) {
+                TraceTraceVertex* const vtxp = vtx.cast<TraceTraceVertex>();
+                if (!vtxp || vtxp->duplicatep()) continue;
+                AstScope* const scopep = traceScopep(vtxp->nodep());
+                const auto pair = groupIndex.emplace(scopep, m_groups.size());
+                if (pair.second) m_groups.emplace_back(scopep);
+                m_groups[pair.first->second].m_traces.emplace_back(actSets.at(vtxp), vtxp);
+            }
+            for (const TraceGroup& group : m_groups) {
+                for (const auto& pair : group.m_traces) vtxps.push_back(pair.second);
+            }
+        }
+
+        // Assign trace codes (signal numbers) to canonical nodes
+        for (TraceTraceVertex* const vtxp : vtxps) {
+            AstTraceDecl* const declp = vtxp->nodep();
+            UASSERT_OBJ(declp->code() == 0, declp,
+                        "Canonical node should not have code assigned yet");
+            declp->code(m_code);
+            const uint32_t codeInc = declp->codeInc();
+            m_code += codeInc;
+            m_statUniqCodes += codeInc;
+            ++m_statUniqSigs;
+        }
+        for (TraceGroup& group : m_groups) {
+            group.m_baseCode = group.m_traces.front().second->nodep()->code();
+        }
+
+        // Duplicate nodes use the code of the canonical node, and are emitted as aliases
+        for (const auto& pair : traces) {
+            if (const TraceTraceVertex* const canonVtxp = pair.second->duplicatep()) {
+                const AstTraceDecl* const canonDeclp = canonVtxp->nodep();
+                UASSERT_OBJ(!canonVtxp->duplicatep(), canonDeclp, "Canonical node is a duplicate");
+                UASSERT_OBJ(canonDeclp->code() != 0, canonDeclp,
+                            "Canonical node should have code assigned already");
+                pair.second->nodep()->code(canonDeclp->code());
+            }
+        }
+    }
+
+    static std::string bufArg() {
+        return v3Global.opt.traceClassBase()
+               + "::" + (v3Global.opt.useTraceOffload() ? "OffloadBuffer" : "Buffer") + "* bufp";
+    }
+
+    AstNodeExpr* newActivityCond(FileLine* flp, const ActCodeSet& actSet) {
+        // Always true, will be folded later
+        if (actSet.count(TraceActivityVertex::ACTIVITY_ALWAYS)) return new AstConst{flp, 1};
+        AstNodeExpr* condp = nullptr;
+        for (const uint32_t actCode : actSet) {
+            AstNodeExpr* const selp = selectActivity(flp, actCode, VAccess::READ);
+            condp = condp ? new AstOr{flp, condp, selp} : selp;
+        }
+        return condp;
+    }
+
     AstCFunc* newCFunc(VTraceType traceType, AstCFunc* topFuncp, uint32_t funcNum,
                        uint32_t baseCode = 0) {
         // Create new function
@@ -512,12 +617,9 @@ class TraceVisitor final : public VNVisitor {
         funcp->isStatic(isTopFunc);
         // Add it to top scope
         m_topScopep->addBlocksp(funcp);
-        const std::string bufArg
-            = v3Global.opt.traceClassBase()
-              + "::" + (v3Global.opt.useTraceOffload() ? "OffloadBuffer" : "Buffer") + "* bufp";
         if (isTopFunc) {
             // Top functions
-            funcp->argTypes("void* voidSelf, " + bufArg);
+            funcp->argTypes("void* voidSelf, " + bufArg());
             funcp->addStmtsp(new AstCStmt{flp, EmitCUtil::voidSelfAssign(m_topModp)});
             funcp->addStmtsp(new AstCStmt{flp, EmitCUtil::symClassAssign()});
             // Add global activity check to change dump functions
@@ -543,7 +645,7 @@ class TraceVisitor final : public VNVisitor {
             }
         } else {
             // Sub functions
-            funcp->argTypes(bufArg);
+            funcp->argTypes(bufArg());
             // Setup base references. Note in rare occasions we can end up with an empty trace
             // sub function, hence the VL_ATTR_UNUSED attributes.
             if (traceType != VTraceType::CHANGE) {
@@ -588,27 +690,10 @@ class TraceVisitor final : public VNVisitor {
         int subStmts = 0;
         for (auto it = traces.cbegin(); it != traces.end(); ++it) {
             const TraceTraceVertex* const vtxp = it->second;
+            // This is a duplicate trace node, emitted as an alias of the
+            // canonical node, so no need to create a TraceInc node.
+            if (vtxp->duplicatep()) continue;
             AstTraceDecl* const declp = vtxp->nodep();
-            if (const TraceTraceVertex* const canonVtxp = vtxp->duplicatep()) {
-                // This is a duplicate trace node. We will assign the signal
-                // number to the canonical node, and emit this as an alias, so
-                // no need to create a TraceInc node.
-                const AstTraceDecl* const canonDeclp = canonVtxp->nodep();
-                UASSERT_OBJ(!canonVtxp->duplicatep(), canonDeclp, "Canonical node is a duplicate");
-                UASSERT_OBJ(canonDeclp->code() != 0, canonDeclp,
-                            "Canonical node should have code assigned already");
-                declp->code(canonDeclp->code());
-                continue;
-            }
-
-            // This is a canonical trace node. Assign trace code (signal number).
-            UASSERT_OBJ(declp->code() == 0, declp,
-                        "Canonical node should not have code assigned yet");
-            declp->code(m_code);
-            const uint32_t codeInc = declp->codeInc();
-            m_code += codeInc;
-            m_statUniqCodes += codeInc;
-            ++m_statUniqSigs;
 
             // If this is a const signal, add the AstTraceInc
             const ActCodeSet& actSet = it->first;
@@ -642,6 +727,8 @@ class TraceVisitor final : public VNVisitor {
             AstCFunc* subChgFuncp = nullptr;
             uint32_t subFuncNum = 0;
             int subStmts = 0;
+            uint32_t subCodeBegin = std::numeric_limits<uint32_t>::max();
+            uint32_t subCodeEnd = 0;
             const uint32_t maxCodes = std::max((nAllCodes + parallelism - 1) / parallelism, 1U);
             uint32_t nCodes = 0;
             const ActCodeSet* prevActSet = nullptr;
@@ -671,6 +758,9 @@ class TraceVisitor final : public VNVisitor {
 
                 // Create new sub function if required
                 if (!subFulFuncp || subStmts > splitLimit) {
+                    addEnabledCheck(subChgFuncp, subCodeBegin, subCodeEnd);
+                    subCodeBegin = std::numeric_limits<uint32_t>::max();
+                    subCodeEnd = 0;
                     baseCode = declp->code();
                     subStmts = 0;
                     subFulFuncp = newCFunc(VTraceType::FULL, topFulFuncp, subFuncNum, baseCode);
@@ -683,18 +773,10 @@ class TraceVisitor final : public VNVisitor {
                 // If required, create the conditional node checking the activity flags
                 if (!prevActSet || actSet != *prevActSet) {
                     FileLine* const flp = m_topScopep->fileline();
-                    const bool always = actSet.count(TraceActivityVertex::ACTIVITY_ALWAYS) != 0;
-                    AstNodeExpr* condp = nullptr;
-                    if (always) {
-                        condp = new AstConst{flp, 1};  // Always true, will be folded later
-                    } else {
-                        for (const uint32_t actCode : actSet) {
-                            AstNodeExpr* const selp = selectActivity(flp, actCode, VAccess::READ);
-                            condp = condp ? new AstOr{flp, condp, selp} : selp;
-                        }
+                    ifp = new AstIf{flp, newActivityCond(flp, actSet)};
+                    if (!actSet.count(TraceActivityVertex::ACTIVITY_ALWAYS)) {
+                        ifp->branchPred(VBranchPred::BP_UNLIKELY);
                     }
-                    ifp = new AstIf{flp, condp};
-                    if (!always) ifp->branchPred(VBranchPred::BP_UNLIKELY);
                     subChgFuncp->addStmtsp(ifp);
                     subStmts += ifp->nodeCount();
                     prevActSet = &actSet;
@@ -724,6 +806,183 @@ class TraceVisitor final : public VNVisitor {
 
                 // Track partitioning
                 nCodes += declp->codeInc();
+
+                // Track codes in sub function
+                subCodeBegin = std::min(subCodeBegin, declp->code());
+                subCodeEnd = std::max(subCodeEnd, declp->code() + declp->codeInc());
+            }
+            addEnabledCheck(subChgFuncp, subCodeBegin, subCodeEnd);
+        }
+    }
+
+    // Skip the change dump sub function at run time if none of its codes are
+    // enabled, e.g. due to dumpScope()
+    void addEnabledCheck(AstCFunc* subChgFuncp, uint32_t codeBegin, uint32_t codeEnd) {
+        if (!subChgFuncp || codeBegin >= codeEnd) return;
+        FileLine* const flp = m_topScopep->fileline();
+        subChgFuncp->stmtsp()->addNextHere(
+            new AstCStmt{flp, "if (VL_UNLIKELY(!bufp->anyEnabled(vlSymsp->__Vm_baseCode + "
+                                  + cvtToStr(codeBegin) + ", vlSymsp->__Vm_baseCode + "
+                                  + cvtToStr(codeEnd) + "))) return;\n"});
+    }
+
+    // Create a function dumping traces under 'scopep' for --trace-share. It takes the absolute
+    // trace code of the first trace in the scope, so it does not depend on the instance.
+    AstCFunc* newSharedCFunc(VTraceType traceType, AstScope* scopep, uint32_t funcNum) {
+        std::string funcName = traceType == VTraceType::CONSTANT ? "trace_const"
+                               : traceType == VTraceType::FULL   ? "trace_full"
+                                                                 : "trace_chg";
+        funcName += "__" + scopep->nameDotless() + "__" + cvtToStr(funcNum);
+        FileLine* const flp = m_topScopep->fileline();
+        AstCFunc* const funcp = new AstCFunc{flp, funcName, scopep};
+        funcp->isTrace(true);
+        funcp->isLoose(true);
+        funcp->slow(traceType != VTraceType::CHANGE);
+        funcp->isStatic(false);
+        funcp->argTypes(bufArg() + ", uint32_t base");
+        scopep->addBlocksp(funcp);
+        if (traceType == VTraceType::CHANGE && v3Global.opt.useTraceOffload()) {
+            funcp->addStmtsp(
+                new AstCStmt{flp, "(void)bufp;  // Prevent unused variable warning\n"});
+        } else {
+            funcp->addStmtsp(new AstCStmt{flp,  //
+                                          "uint32_t* const oldp VL_ATTR_UNUSED = "
+                                          "bufp->oldp(base);\n"});
+        }
+        ++m_statInstFuncs;
+        return funcp;
+    }
+
+    AstNodeStmt* newSharedCall(AstCFunc* funcp, uint32_t baseCode) {
+        AstCCall* const callp = new AstCCall{m_topScopep->fileline(), funcp};
+        callp->dtypeSetVoid();
+        callp->argTypes("bufp, vlSymsp->__Vm_baseCode + " + cvtToStr(baseCode));
+        return callp->makeStmt();
+    }
+
+    // With --trace-share, the traces under each scope are dumped by functions under that
+    // scope, called from the top trace functions with the code of the first trace in the
+    // scope. After V3Descope these are identical for instances of the same module with the
+    // same traced signals, and V3Combine keeps only one of them.
+    void createSharedTraceFunctions(uint32_t nAllCodes, uint32_t parallelism) {
+        const int splitLimit = v3Global.opt.outputSplitCTrace() ? v3Global.opt.outputSplitCTrace()
+                                                                : std::numeric_limits<int>::max();
+        FileLine* const flp = m_topScopep->fileline();
+
+        // Add a call to a shared function, creating a new sub function if required
+        const auto addCall = [&](VTraceType traceType, SharedCaller& caller, AstNodeStmt* stmtp) {
+            if (!caller.m_subFuncp || caller.m_subStmts > splitLimit) {
+                caller.m_subStmts = 0;
+                caller.m_subFuncp = newCFunc(traceType, caller.m_topFuncp, caller.m_subFuncNum);
+                ++caller.m_subFuncNum;
+            }
+            caller.m_subFuncp->addStmtsp(stmtp);
+            caller.m_subStmts += stmtp->nodeCount();
+        };
+
+        SharedCaller constCaller;
+        constCaller.m_topFuncp = newCFunc(VTraceType::CONSTANT, nullptr, 0);
+        SharedCaller fulCaller;
+        SharedCaller chgCaller;
+        // pre-incremented, so starts at 0
+        uint32_t topFuncNum = std::numeric_limits<uint32_t>::max();
+        const uint32_t maxCodes = std::max((nAllCodes + parallelism - 1) / parallelism, 1U);
+        uint32_t nCodes = 0;
+
+        for (const TraceGroup& group : m_groups) {
+            AstScope* const scopep = group.m_scopep;
+            const uint32_t baseCode = group.m_baseCode;
+            uint32_t funcNum = 0;
+            auto it = group.m_traces.cbegin();
+            while (it != group.m_traces.cend()) {
+                // Gather the next run of traces small enough for one function
+                std::vector<AstTraceDecl*> constDeclps;
+                std::vector<AstTraceDecl*> declps;
+                std::map<ActCodeSet, std::vector<AstTraceDecl*>> chgDeclps;
+                int stmts = 0;
+                for (; it != group.m_traces.cend() && stmts <= splitLimit; ++it) {
+                    const ActCodeSet& actSet = *it->first;
+                    AstTraceDecl* const declp = it->second->nodep();
+                    if (actSet.count(TraceActivityVertex::ACTIVITY_NEVER)) {
+                        constDeclps.push_back(declp);
+                    } else {
+                        declps.push_back(declp);
+                        chgDeclps[actSet].push_back(declp);
+                    }
+                    const VNumRange range = declp->arrayRange();
+                    // 2x because each element is a TraceInc and a VarRef
+                    stmts += range.ranged() ? range.elements() * 2
+                                            : declp->valuep()->nodeCount() + 1;
+                }
+
+                // Const dump
+                if (!constDeclps.empty()) {
+                    AstCFunc* const funcp
+                        = newSharedCFunc(VTraceType::CONSTANT, scopep, funcNum++);
+                    for (AstTraceDecl* const declp : constDeclps) {
+                        funcp->addStmtsp(new AstTraceInc{declp->fileline(), declp,
+                                                         VTraceType::CONSTANT, baseCode});
+                    }
+                    addCall(VTraceType::CONSTANT, constCaller, newSharedCall(funcp, baseCode));
+                }
+                if (declps.empty()) continue;
+
+                // Create new top functions if required
+                if (!fulCaller.m_topFuncp || nCodes >= maxCodes) {
+                    ++topFuncNum;
+                    nCodes = 0;
+                    fulCaller = SharedCaller{};
+                    fulCaller.m_topFuncp = newCFunc(VTraceType::FULL, nullptr, topFuncNum);
+                    chgCaller = SharedCaller{};
+                    chgCaller.m_topFuncp = newCFunc(VTraceType::CHANGE, nullptr, topFuncNum);
+                }
+
+                // Full dump
+                AstCFunc* const fulFuncp = newSharedCFunc(VTraceType::FULL, scopep, funcNum++);
+                for (AstTraceDecl* const declp : declps) {
+                    fulFuncp->addStmtsp(
+                        new AstTraceInc{declp->fileline(), declp, VTraceType::FULL, baseCode});
+                    declp->fidx(topFuncNum);
+                    nCodes += declp->codeInc();
+                }
+                addCall(VTraceType::FULL, fulCaller, newSharedCall(fulFuncp, baseCode));
+
+                // Change dump, one function per activity set, called if any flag is set
+                for (const auto& pair : chgDeclps) {
+                    const ActCodeSet& actSet = pair.first;
+                    AstCFunc* const chgFuncp
+                        = newSharedCFunc(VTraceType::CHANGE, scopep, funcNum++);
+                    // Skip at run time if none of its codes are enabled, e.g. due to dumpScope()
+                    uint32_t codeBegin = std::numeric_limits<uint32_t>::max();
+                    uint32_t codeEnd = 0;
+                    for (const AstTraceDecl* const declp : pair.second) {
+                        codeBegin = std::min(codeBegin, declp->code());
+                        codeEnd = std::max(codeEnd, declp->code() + declp->codeInc());
+                    }
+                    chgFuncp->addStmtsp(new AstCStmt{
+                        flp, "if (VL_UNLIKELY(!bufp->anyEnabled(base + "
+                                 + cvtToStr(codeBegin - baseCode) + ", base + "
+                                 + cvtToStr(codeEnd - baseCode) + "))) return;\n"});
+                    for (AstTraceDecl* const declp : pair.second) {
+                        chgFuncp->addStmtsp(new AstTraceInc{declp->fileline(), declp,
+                                                            VTraceType::CHANGE, baseCode});
+                    }
+                    AstIf* const ifp = new AstIf{flp, newActivityCond(flp, actSet),
+                                                 newSharedCall(chgFuncp, baseCode)};
+                    if (!actSet.count(TraceActivityVertex::ACTIVITY_ALWAYS)) {
+                        ifp->branchPred(VBranchPred::BP_UNLIKELY);
+                    }
+                    addCall(VTraceType::CHANGE, chgCaller, ifp);
+                }
+            }
+        }
+
+        // Duplicate decls must have the function index of the canonical node
+        for (V3GraphVertex& vtx : m_graph.vertices()) {
+            if (TraceTraceVertex* const vtxp = vtx.cast<TraceTraceVertex>()) {
+                if (const TraceTraceVertex* const canonVtxp = vtxp->duplicatep()) {
+                    vtxp->nodep()->fidx(canonVtxp->nodep()->fidx());
+                }
             }
         }
     }
@@ -734,6 +993,7 @@ class TraceVisitor final : public VNVisitor {
         cleanupFuncp->argTypes("void* voidSelf, " + v3Global.opt.traceClassBase()
                                + "* /*unused*/");
         cleanupFuncp->isTrace(true);
+        cleanupFuncp->dontCombine(true);
         cleanupFuncp->slow(false);
         cleanupFuncp->isStatic(true);
         cleanupFuncp->isLoose(true);
@@ -793,16 +1053,25 @@ class TraceVisitor final : public VNVisitor {
         m_regFuncp = new AstCFunc{m_topScopep->fileline(), "trace_register", m_topScopep};
         m_regFuncp->argTypes(v3Global.opt.traceClassBase() + "* tracep");
         m_regFuncp->isTrace(true);
+        m_regFuncp->dontCombine(true);
         m_regFuncp->slow(true);
         m_regFuncp->isStatic(false);
         m_regFuncp->isLoose(true);
         m_topScopep->addBlocksp(m_regFuncp);
 
-        // Create the const dump functions. Also allocates trace codes.
-        createConstTraceFunctions(traces);
+        // Allocate trace codes
+        assignCodes(traces);
+
+        if (v3Global.opt.traceShare()) {
+            // Create all dump functions, shared between instances
+            createSharedTraceFunctions(nNonConstCodes, m_parallelism);
+        } else {
+            // Create the const dump functions
+            createConstTraceFunctions(traces);
 
-        // Create the full and incremental dump functions
-        createNonConstTraceFunctions(traces, nNonConstCodes, m_parallelism);
+            // Create the full and incremental dump functions
+            createNonConstTraceFunctions(traces, nNonConstCodes, m_parallelism);
+        }
 
         // Remove refs to traced values from TraceDecl nodes, these have now moved under
         // TraceInc
@@ -947,6 +1216,9 @@ public:
         V3Stats::addStat("Tracing, Activity slow blocks", m_statSettersSlow);
         V3Stats::addStat("Tracing, Unique trace codes", m_statUniqCodes);
         V3Stats::addStat("Tracing, Unique traced signals", m_statUniqSigs);
+        if (v3Global.opt.traceShare()) {
+            V3Stats::addStat("Tracing, Instance trace functions", m_statInstFuncs);
+        }
     }
 };
 
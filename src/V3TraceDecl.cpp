@@ -201,6 +201,7 @@ class TraceDeclVisitor final : public VNVisitor {
         AstCFunc* const funcp = new AstCFunc{flp, name, topScopep};
         funcp->argTypes(v3Global.opt.traceClassBase() + "* tracep");
         funcp->isTrace(true);
+        funcp->dontCombine(true);
         funcp->isStatic(false);
         funcp->isLoose(true);
         funcp->slow(true);
@@ -0,0 +1,185 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+// DESCRIPTION: Verilator: Flag writes to VPI visible signals
+//
+// Code available from: https://verilator.org
+//
+//*************************************************************************
+//
+// Copyright 2003-2025 by Wilson Snyder. This program is free software; you
+// can redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+// V3VpiDirty's Transformations:
+//
+// Each VPI visible variable only written by assignments:
+//   Give it an index among the flagged variables of its module
+// Each scope of a module with flagged variables:
+//   Reserve a flag for each such variable in __Vm_vpiDirty
+// Each assignment to a flagged variable:
+//   Set the flag of the variable in the scope written after it
+//
+// The VPI runtime then only compares the variables with cbValueChange
+// callbacks whose flag is set, see VerilatedVpiImp::callValueCbs
+//
+//*************************************************************************
+
+#include "V3PchAstNoMT.h"  // VL_MT_DISABLED_CODE_UNIT
+
+#include "V3VpiDirty.h"
+
+#include "V3Stats.h"
+
+VL_DEFINE_DEBUG_FUNCTIONS;
+
+//######################################################################
+// VPI dirty flag visitor
+
+class VpiDirtyVisitor final : public VNVisitor {
+    // NODE STATE
+    //  AstVar::user1()         -> bool. Written other than by an assignment in a function
+    //  AstNodeModule::user2()  -> int. Number of flagged variables in module
+    const VNUser1InUse m_user1InUse;
+    const VNUser2InUse m_user2InUse;
+
+    // STATE - across all visitors
+    std::vector<std::pair<AstNodeModule*, AstVar*>> m_varps;  // Candidate variables
+    // Assignments to candidate variables, and the variable written
+    std::vector<std::pair<AstNodeAssign*, AstVarScope*>> m_writes;
+    AstVarScope* m_flagsVscp = nullptr;  // The __Vm_vpiDirty variable
+    VDouble0 m_statVars;  // Statistic tracking
+    VDouble0 m_statSetters;  // Statistic tracking
+
+    // STATE - for current visit position (use VL_RESTORER)
+    AstNodeModule* m_modp = nullptr;  // Current module
+    AstCFunc* m_cfuncp = nullptr;  // Current function
+    AstNodeAssign* m_assignp = nullptr;  // Current assignment, when under its LHS
+
+    // METHODS
+    static bool isCandidate(const AstVar* varp) {
+        // As registered with the VPI by V3EmitCSyms
+        if (!varp->isSigUserRdPublic() && !varp->isSigUserRWPublic()) return false;
+        // Written by the user, not the model
+        if (varp->isParam() || varp->isPrimaryInish() || varp->isForceable()) return false;
+        return true;
+    }
+
+    void createFlags(AstNetlist* netlistp) {
+        // Number the flagged variables of each module
+        for (const auto& pair : m_varps) {
+            AstNodeModule* const modp = pair.first;
+            AstVar* const varp = pair.second;
+            if (varp->user1()) continue;
+            varp->vpiDirtyIndex(modp->user2());
+            modp->user2(modp->user2() + 1);
+            ++m_statVars;
+        }
+        // Each scope holds the flags of its module's variables
+        uint32_t nFlags = 0;
+        netlistp->foreach([&](AstScope* scopep) {
+            scopep->vpiDirtyBase(nFlags);
+            nFlags += scopep->modp()->user2();
+        });
+        if (!nFlags) return;
+
+        // Create an array of bytes, not a bit vector, as they can be set
+        // by mtasks without a read-modify-write, as with V3Trace activity
+        AstScope* const topScopep = netlistp->topScopep()->scopep();
+        FileLine* const flp = topScopep->fileline();
+        AstNodeDType* const newScalarDtp = new AstBasicDType{flp, VFlagBitPacked{}, 1};
+        netlistp->typeTablep()->addTypesp(newScalarDtp);
+        AstRange* const newArange
+            = new AstRange{flp, VNumRange{static_cast<int>(nFlags) - 1, 0}};
+        AstNodeDType* const newArrDtp = new AstUnpackArrayDType{flp, newScalarDtp, newArange};
+        netlistp->typeTablep()->addTypesp(newArrDtp);
+        AstVar* const newvarp = new AstVar{flp, VVarType::MODULETEMP, "__Vm_vpiDirty", newArrDtp};
+        newvarp->sigPublic(true);  // Read and cleared by the VPI runtime
+        netlistp->topModulep()->addStmtsp(newvarp);
+        m_flagsVscp = new AstVarScope{flp, topScopep, newvarp};
+        topScopep->addVarsp(m_flagsVscp);
+        netlistp->vpiDirtyp(newvarp);
+    }
+
+    void insertSetters() {
+        std::set<std::pair<const AstNodeAssign*, uint32_t>> done;
+        for (const auto& pair : m_writes) {
+            AstNodeAssign* const assignp = pair.first;
+            const AstVarScope* const vscp = pair.second;
+            const int index = vscp->varp()->vpiDirtyIndex();
+            if (index < 0) continue;
+            const uint32_t flag = vscp->scopep()->vpiDirtyBase() + index;
+            if (!done.emplace(assignp, flag).second) continue;  // Already set, e.g. concat LHS
+            FileLine* const flp = assignp->fileline();
+            AstNodeExpr* const selp
+                = new AstArraySel{flp, new AstVarRef{flp, m_flagsVscp, VAccess::WRITE}, flag};
+            assignp->addNextHere(new AstAssign{flp, selp, new AstConst{flp, AstConst::BitTrue{}}});
+            ++m_statSetters;
+        }
+    }
+
+    // VISITORS
+    void visit(AstNetlist* nodep) override {
+        iterateChildren(nodep);
+        createFlags(nodep);
+        if (m_flagsVscp) insertSetters();
+    }
+    void visit(AstNodeModule* nodep) override {
+        VL_RESTORER(m_modp);
+        m_modp = nodep;
+        iterateChildren(nodep);
+    }
+    void visit(AstVar* nodep) override {
+        if (!m_cfuncp && isCandidate(nodep)) m_varps.emplace_back(m_modp, nodep);
+    }
+    void visit(AstCFunc* nodep) override {
+        VL_RESTORER(m_cfuncp);
+        m_cfuncp = nodep;
+        iterateChildren(nodep);
+    }
+    void visit(AstNodeAssign* nodep) override {
+        // Writes by assignments outside of functions, e.g. aliases, are not flagged
+        if (!m_cfuncp) {
+            iterateChildren(nodep);
+            return;
+        }
+        {
+            VL_RESTORER(m_assignp);
+            m_assignp = nodep;
+            iterate(nodep->lhsp());
+        }
+        iterate(nodep->rhsp());
+        iterateAndNextNull(nodep->timingControlp());
+    }
+    void visit(AstCReset* nodep) override {}  // Initialization before VPI can register callbacks
+    void visit(AstVarRef* nodep) override {
+        if (!nodep->access().isWriteOrRW()) return;
+        AstVar* const varp = nodep->varp();
+        if (!isCandidate(varp)) return;
+        if (m_assignp) {
+            m_writes.emplace_back(m_assignp, nodep->varScopep());
+        } else {
+            varp->user1(true);
+        }
+    }
+    void visit(AstNode* nodep) override { iterateChildren(nodep); }
+
+public:
+    // CONSTRUCTORS
+    explicit VpiDirtyVisitor(AstNetlist* nodep) { iterate(nodep); }
+    ~VpiDirtyVisitor() override {
+        V3Stats::addStat("VPI, Flagged variables", m_statVars);
+        V3Stats::addStat("VPI, Flag setters", m_statSetters);
+    }
+};
+
+//######################################################################
+// VpiDirty class functions
+
+void V3VpiDirty::vpiDirtyAll(AstNetlist* nodep) {
+    UINFO(2, __FUNCTION__ << ":");
+    { VpiDirtyVisitor{nodep}; }  // Destruct before checking
+    V3Global::dumpCheckGlobalTree("vpidirty", 0, dumpTreeEitherLevel() >= 3);
+}
@@ -18,6 +18,7 @@
 
 #include "V3Active.h"
 #include "V3ActiveTop.h"
+#include "V3Allocator.h"
 #include "V3Assert.h"
 #include "V3AssertPre.h"
 #include "V3AssertProp.h"
@@ -66,6 +67,7 @@
 #include "V3InlineCFuncs.h"
 #include "V3Inst.h"
 #include "V3Interface.h"
+#include "V3JobServer.h"
 #include "V3LibMap.h"
 #include "V3Life.h"
 #include "V3LifePost.h"
@@ -112,6 +114,7 @@
 #include "V3Unknown.h"
 #include "V3Unroll.h"
 #include "V3VariableOrder.h"
+#include "V3VpiDirty.h"
 #include "V3Waiver.h"
 #include "V3Width.h"
 #include "V3WidthCommit.h"
@@ -185,6 +188,8 @@ static void process() {
 
         // Remove any modules that were parameterized and are no longer referenced.
         V3Dead::deadifyModules(v3Global.rootp());
+        // Parameterization deletes many nodes, release their memory
+        V3Allocator::trim();
 
         v3Global.checkTree();
         if (v3Global.hasTable()) V3Udp::udpResolve(v3Global.rootp());
@@ -489,6 +494,11 @@ static void process() {
             // "effectively" activate the same way.)
             if (v3Global.opt.trace()) V3Trace::traceAll(v3Global.rootp());
 
+            // Flag writes to VPI visible signals for value change callbacks
+            if (v3Global.opt.vpi() && v3Global.opt.vpiDirty()) {
+                V3VpiDirty::vpiDirtyAll(v3Global.rootp());
+            }
+
             if (v3Global.opt.stats()) V3Stats::statsStageAll(v3Global.rootp(), "Scoped");
         }
 
@@ -524,6 +534,7 @@ static void process() {
             // Remove unused vars
             V3Const::constifyAll(v3Global.rootp());
             V3Dead::deadifyAll(v3Global.rootp());
+            V3Allocator::trim();
 
             // Here down, widthMin() is the Verilog width, and width() is the C++ width
             // Bits between widthMin() and width() are irrelevant, but may be non zero.
@@ -691,11 +702,22 @@ static bool verilate(const string& argString) {
         v3fatalSrc("VERILATOR_DEBUG_SKIP_IDENTICAL w/ --skip-identical: Changes found\n");
     }  // LCOV_EXCL_STOP
 
+    // Under a make jobserver (e.g. hierarchical Verilation), threads beyond
+    // the first need a free job slot, so parallel Verilations don't oversubscribe
+    int verilateJobs = v3Global.opt.verilateJobs();
+    if (verilateJobs > 1 && V3JobServer::available()) {
+        verilateJobs = 1 + V3JobServer::acquire(verilateJobs - 1);
+    } else if (verilateJobs > 1 && V3JobServer::named()) {
+        v3info("Make jobserver is not usable from this process, so using all "
+               << verilateJobs << " --verilate-jobs threads without job slots."
+               << " Prefix the make recipe with '+' to share make's job slots.");
+    }
+
     // Disable mutexes in single-thread verilation
-    V3MutexConfig::s().configure(v3Global.opt.verilateJobs() > 1 /*enable*/);
+    V3MutexConfig::s().configure(verilateJobs > 1 /*enable*/);
 
     // Initialize thread pool
-    v3Global.threadPoolp(new V3ThreadPool{v3Global.opt.verilateJobs()});
+    v3Global.threadPoolp(new V3ThreadPool{verilateJobs});
 
     // --FRONTEND------------------
 
@@ -805,6 +827,8 @@ static bool verilate(const string& argString) {
     v3Global.rootp()->deleteContents();
     V3Os::releaseMemory();
     if (v3Global.opt.stats()) V3Stats::statsStage("released");
+    // Thread pool is now idle, give job slots back for --build
+    V3JobServer::release();
     return true;
 }
 
@@ -1122,6 +1122,11 @@ class VlTest:
                 self.trace_format = 'saif-sc'  # pylint: disable=attribute-defined-outside-init
             else:
                 self.trace_format = 'saif-c'  # pylint: disable=attribute-defined-outside-init
+        elif re.search(r'-trace-vbt', checkflags):
+            if self.sc:
+                self.trace_format = 'vbt-sc'  # pylint: disable=attribute-defined-outside-init
+            else:
+                self.trace_format = 'vbt-c'  # pylint: disable=attribute-defined-outside-init
         elif self.sc:
             self.trace_format = 'vcd-sc'  # pylint: disable=attribute-defined-outside-init
         else:
@@ -1705,6 +1710,8 @@ class VlTest:
             return self.obj_dir + "/simx.fst"
         if re.match(r'^saif', self.trace_format):
             return self.obj_dir + "/simx.saif"
+        if re.match(r'^vbt', self.trace_format):
+            return self.obj_dir + "/simx.vbt"
         return self.obj_dir + "/simx.vcd"
 
     def skip_if_too_few_cores(self) -> None:
@@ -2043,6 +2050,10 @@ class VlTest:
                 fh.write("#include \"verilated_saif_c.h\"\n")
             if self.trace and self.trace_format == 'saif-sc':
                 fh.write("#include \"verilated_saif_sc.h\"\n")
+            if self.trace and self.trace_format == 'vbt-c':
+                fh.write("#include \"verilated_vbt_c.h\"\n")
+            if self.trace and self.trace_format == 'vbt-sc':
+                fh.write("#include \"verilated_vbt_sc.h\"\n")
             if self.savable:
                 fh.write("#include \"verilated_save.h\"\n")
 
@@ -2132,6 +2143,10 @@ class VlTest:
                     fh.write("    std::unique_ptr<VerilatedSaifC> tfp{new VerilatedSaifC};\n")
                 if self.trace_format == 'saif-sc':
                     fh.write("    std::unique_ptr<VerilatedSaifSc> tfp{new VerilatedSaifSc};\n")
+                if self.trace_format == 'vbt-c':
+                    fh.write("    std::unique_ptr<VerilatedVbtC> tfp{new VerilatedVbtC};\n")
+                if self.trace_format == 'vbt-sc':
+                    fh.write("    std::unique_ptr<VerilatedVbtSc> tfp{new VerilatedVbtSc};\n")
                 if self.sc:
                     fh.write("    sc_core::sc_start(sc_core::SC_ZERO_TIME);" +
                              "  // Finish elaboration before trace and open\n")
@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+import time
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_skipidentical.v"
+
+test.compile(verilator_flags2=['--output-keep-unchanged', '--stats'])
+
+cpp_filename = test.obj_dir + "/" + test.vm_prefix + ".cpp"
+oldtime = os.path.getmtime(cpp_filename)
+
+time.sleep(2)  # Or else it might take < 1 second to compile and see no diff.
+
+# Re-verilate; output is identical, so it must not be rewritten
+test.compile(verilator_flags2=['--output-keep-unchanged', '--stats', '--no-skip-identical'])
+
+newtime = os.path.getmtime(cpp_filename)
+if oldtime != newtime:
+    test.error("--output-keep-unchanged was ignored -- regenerated " + cpp_filename)
+
+test.file_grep(test.stats, r'Output, C\+\+ files unchanged\s+(\d+)')
+
+test.passes()
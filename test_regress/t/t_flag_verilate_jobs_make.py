@@ -0,0 +1,41 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you can
+# redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+import sys
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_main.v"
+
+if sys.platform != "linux":
+    test.skip("Jobserver pipes are only reopened non-blocking on Linux")
+
+# Two Verilations in sequence from a 'make -j3', each asking for 8 threads.
+# With one job running, make leaves 2 free slots, so each Verilation may only
+# use 2 additional threads, and the second only gets them if the first
+# returned its slots.
+verilator = "perl " + os.environ["VERILATOR_ROOT"] + "/bin/verilator"
+flags = ("--lint-only --verilate-jobs 8 --debugi-V3JobServer 1 -Mdir " + test.obj_dir + " " +
+         test.top_filename)
+test.write_wholefile(
+    test.obj_dir + "/jobs.mk", "second: first\n"
+    "\t+" + verilator + " " + flags + "\n"
+    "first:\n"
+    "\t+" + verilator + " " + flags + "\n")
+
+test.run(cmd=[os.environ['MAKE'], "-j3", "-f", test.obj_dir + "/jobs.mk", "second"],
+         logfile=test.obj_dir + "/make.log",
+         verilator_run=True)
+
+test.file_grep_count(test.obj_dir + "/make.log", r'Jobserver: Holding 2 additional job slots', 2)
+test.file_grep_not(test.obj_dir + "/make.log", r'Jobserver: Holding [3-9]')
+# GNU Make reports slots that were not returned
+test.file_grep_not(test.obj_dir + "/make.log", r'jobserver tokens|INTERNAL')
+
+test.passes()
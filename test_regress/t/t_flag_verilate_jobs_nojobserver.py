@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you can
+# redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_flag_main.v"
+
+# As from a make recipe without '+', MAKEFLAGS names the jobserver, but its
+# descriptors are not open in this process. All requested threads are used.
+test.run(cmd=[
+    "MAKEFLAGS='-j4 --jobserver-auth=98,99'", "perl",
+    os.environ["VERILATOR_ROOT"] + "/bin/verilator", "--lint-only --verilate-jobs 4",
+    "--debugi-V3JobServer 1 -Mdir", test.obj_dir, test.top_filename
+],
+         logfile=test.obj_dir + "/vlt_compile.log",
+         verilator_run=True)
+
+test.file_grep(test.obj_dir + "/vlt_compile.log", r'Jobserver: Not usable from this process')
+test.file_grep(test.obj_dir + "/vlt_compile.log",
+               r'%Info:.*Make jobserver is not usable from this process, so using all 4')
+
+test.passes()
@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you can
+# redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_hier_block.v"
+
+# stats will be deleted but generation will be skipped if libs of hierarchical blocks exist.
+test.clean_objs()
+
+# Hierarchical child Verilations run under make, taking jobserver slots for extra threads
+test.compile(v_flags2=['t/t_hier_block.cpp'],
+             verilator_flags2=[
+                 '--stats', '--hierarchical', '--Wno-TIMESCALEMOD', '--CFLAGS',
+                 '"-pipe -DCPP_MACRO=cplusplus"', '--verilate-jobs 4'
+             ])
+
+test.execute()
+
+test.file_grep(test.obj_dir + "/Vsub0__hierMkArgs.f", r'--verilate-jobs 4')
+test.file_grep(test.obj_dir + "/" + test.vm_prefix + "__hierMkArgs.f", r'--verilate-jobs 4')
+test.file_grep(test.obj_dir + "/" + test.vm_prefix + "_hier.mk", r'\+\$\(VM_HIER_VERILATOR\)')
+
+test.passes()
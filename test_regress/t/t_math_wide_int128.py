@@ -0,0 +1,21 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+# Same test as t_math_wide_template, but without 128-bit integers
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_math_wide_simd.v"
+
+test.compile(verilator_flags2=['--expand-limit 1 -CFLAGS -DVL_DISABLE_INT128'])
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,124 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+`define stop $stop
+`define checkh(gotv,expv) do if ((gotv) !== (expv)) begin $write("%%Error: %s:%0d:  got='h%x exp='h%x\n", `__FILE__,`__LINE__, (gotv), (expv)); `stop; end while(0);
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+
+   // Widths chosen to have full vector blocks, plus a scalar tail
+   sub #(.WIDTH(1000)) u_1000 (.clk(clk), .cyc(cyc));
+   sub #(.WIDTH(260)) u_260 (.clk(clk), .cyc(cyc));
+   sub #(.WIDTH(96)) u_96 (.clk(clk), .cyc(cyc));
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 9) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+module sub #(parameter WIDTH = 1) (/*AUTOARG*/
+   // Inputs
+   clk, cyc
+   );
+   input clk;
+   input integer cyc;
+
+   reg [WIDTH-1:0] a;
+   reg [WIDTH-1:0] b;
+   reg [WIDTH-1:0] ones;
+   reg [WIDTH-1:0] one;
+   reg [WIDTH-1:0] r;
+   reg x;
+
+   always @ (posedge clk) begin
+      // Values are set from cyc, so operations are not constant folded
+      ones <= '1;
+      one <= {{WIDTH-1{1'b0}}, cyc != 999};
+      a <= {(WIDTH + 31) / 32{32'ha5a5_5a5a ^ cyc}};
+      b <= {(WIDTH + 31) / 32{32'h0f0f_1234 + cyc}};
+      if (cyc > 2) begin
+         // Bitwise
+         r = a & b;
+         for (int i = 0; i < WIDTH; ++i) `checkh(r[i], a[i] & b[i]);
+         r = a | b;
+         for (int i = 0; i < WIDTH; ++i) `checkh(r[i], a[i] | b[i]);
+         r = a ^ b;
+         for (int i = 0; i < WIDTH; ++i) `checkh(r[i], a[i] ^ b[i]);
+         r = ~a;
+         for (int i = 0; i < WIDTH; ++i) `checkh(r[i], !a[i]);
+         // Reductions and equality
+         x = 1'b0;
+         for (int i = 0; i < WIDTH; ++i) x = x ^ a[i];
+         `checkh(^a, x);
+         `checkh(a == a, 1'b1);
+         `checkh(a == b, 1'b0);
+         `checkh(a != b, 1'b1);
+         r = a;
+         r[WIDTH-1] = !r[WIDTH-1];
+         `checkh(a == r, 1'b0);
+         r = a;
+         r[0] = !r[0];
+         `checkh(a == r, 1'b0);
+         // Carry and borrow through every word
+         r = ones + one;
+         `checkh(r, {WIDTH{1'b0}});
+         r = {WIDTH{1'b0}} - one;
+         `checkh(r, ones);
+         r = a + ~a;
+         `checkh(r, ones);
+         r = a - a;
+         `checkh(r, {WIDTH{1'b0}});
+         r = (a + b) - b;
+         `checkh(r, a);
+         r = (a - b) + b;
+         `checkh(r, a);
+         r = a + b;
+         `checkh(r - a, b);
+         r = -a;
+         `checkh(r + a, {WIDTH{1'b0}});
+         // Comparisons, a is never zero
+         r = a >> 1;
+         `checkh(a > r, 1'b1);
+         `checkh(a >= r, 1'b1);
+         `checkh(a < r, 1'b0);
+         `checkh(a <= r, 1'b0);
+         `checkh(a <= a, 1'b1);
+         `checkh(a >= a, 1'b1);
+         `checkh(a < a, 1'b0);
+         // Multiply
+         `checkh(a * one, a);
+         `checkh(a * (one + one), a + a);
+         `checkh(a * b, b * a);
+         `checkh(a * (b + one), a * b + a);
+         r = '0;
+         for (int i = 0; i < WIDTH; ++i) if (b[i]) r = r + (a << i);
+         `checkh(a * b, r);
+         // Shifts by variable amounts, covering word aligned and unaligned
+         for (int s = 0; s < WIDTH + 40; s = s + 7 + cyc) begin
+            r = a << s;
+            for (int i = 0; i < WIDTH; ++i) `checkh(r[i], i >= s ? a[i - s] : 1'b0);
+            r = a >> s;
+            for (int i = 0; i < WIDTH; ++i) `checkh(r[i], i + s < WIDTH ? a[i + s] : 1'b0);
+            r = $signed(a) >>> s;
+            for (int i = 0; i < WIDTH; ++i) `checkh(r[i], i + s < WIDTH ? a[i + s] : a[WIDTH-1]);
+         end
+         r = a << 32;
+         `checkh(r >> 32, a & (ones >> 32));
+      end
+   end
+endmodule
@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+# Same test as t_math_wide_simd, checking fixed-width functions are used
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_math_wide_simd.v"
+
+test.compile(verilator_flags2=['--expand-limit 1'])
+
+test.execute()
+
+files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.cpp")
+# 96 bits, 3 words
+test.file_grep_any(files, r'VL_ADD_W<3>\(')
+test.file_grep_any(files, r'VL_SUB_W<3>\(')
+test.file_grep_any(files, r'VL_EQ_W<3>\(')
+test.file_grep_any(files, r'VL_MUL_W<3>\(')
+# 1000 bits, over the fixed-width limit
+test.file_grep_any(files, r'VL_ADD_W\(32,')
+
+test.passes()
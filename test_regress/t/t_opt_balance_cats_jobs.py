@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_opt_balance_cats.v"
+
+# Same results as serial t_opt_balance_cats when functions are optimized in parallel
+test.compile(verilator_flags2=[
+    "--stats", "--build", "--gate-stmts", "10000", "--expand-limit", "128", "--verilate-jobs", "4"
+])
+
+test.file_grep(test.stats, r'Optimizations, FuncOpt concat trees balanced\s+(\d+)', 1)
+test.file_grep(test.stats, r'Optimizations, FuncOpt concat splits\s+(\d+)', 62)
+
+test.passes()
@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+
+test.compile(
+    verilator_flags=[  # Custom as don't want -cc
+        "-Mdir", test.obj_dir, "--debug-check"
+    ],
+    verilator_flags2=[
+        "--binary", "--prof-pgo-merge mean", "--prof-pgo-loop 3",
+        "--prof-pgo-run " + test.obj_dir + "/" + test.vm_prefix,
+        "--prof-pgo-run " + test.obj_dir + "/" + test.vm_prefix
+    ],
+    threads=2)
+
+# Profiled, then re-Verilated with profiles twice, comparing the last two
+test.file_grep_count(test.compile_log_filename, r'Profile-guided optimization iteration', 3)
+test.file_grep_count(test.compile_log_filename, r'Critical path cost \d+, changed', 1)
+for run in range(2):
+    test.file_grep(test.obj_dir + "/profile_pgo_" + str(run) + ".vlt", r'profile_data -model ')
+
+# Final model is built without --prof-pgo
+test.execute()
+test.file_grep_not(test.obj_dir + "/" + test.vm_prefix + "__Syms.h", r'VlPgoProfiler')
+
+test.passes()
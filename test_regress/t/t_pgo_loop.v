@@ -0,0 +1,31 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+
+  logic clk = 0;
+  always #5 clk = ~clk;
+
+  int cyc = 0;
+  logic [63:0] a = 1;
+  logic [63:0] b = 2;
+  logic [63:0] c = 3;
+
+  // Independent logic, so there are multiple mtasks to profile
+  always @(posedge clk) a <= a * 64'd6364136223846793005 + 64'd1442695040888963407;
+  always @(posedge clk) b <= {b[62:0], b[63] ^ b[62] ^ b[60] ^ b[59]};
+  always @(posedge clk) c <= c + (c >> 3) + 64'd7;
+
+  always @(posedge clk) begin
+    cyc <= cyc + 1;
+    if (cyc == 1000) begin
+      $display("%x", a ^ b ^ c);
+      $write("*-* All Finished *-*\n");
+      $finish;
+    end
+  end
+
+endmodule
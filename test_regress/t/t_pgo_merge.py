@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import re
+
+import vltest_bootstrap
+
+test.scenarios('vltmt')
+test.top_filename = "t/t_gen_alw.v"  # It doesn't really matter what test
+
+test.compile(v_flags2=["--prof-pgo"], threads=2)
+
+for run in range(2):
+    test.execute(all_run_flags=[
+        "+verilator+prof+exec+start+0",
+        " +verilator+prof+exec+file+/dev/null",
+        " +verilator+prof+vlt+file+" + test.obj_dir + "/profile" + str(run) + ".vlt"])  # yapf:disable
+    test.file_grep(test.obj_dir + "/profile" + str(run) + ".vlt", r'profile_data ')
+
+# Make a third profile with a known workload difference: the first mtask is
+# much more expensive, and the last mtask never ran so is missing
+mtask_lines = []
+other_lines = []
+with open(test.obj_dir + "/profile0.vlt", 'r', encoding="utf8") as fh:
+    for line in fh:
+        (mtask_lines if re.search(r'-mtask ', line) else other_lines).append(line)
+if len(mtask_lines) < 2:
+    test.error("Expected multiple mtasks in profile")
+mtask_lines[0] = re.sub(r"64'd(\d+)", lambda m: "64'd" + str(int(m.group(1)) * 8 + 1000),
+                        mtask_lines[0])
+with open(test.obj_dir + "/profile2.vlt", 'w', encoding="utf8") as fh:
+    fh.writelines(other_lines + mtask_lines[:-1])
+
+test.compile(v_flags2=[
+    "--stats", "--prof-pgo-merge p90", " " + test.obj_dir + "/profile0.vlt",
+    " " + test.obj_dir + "/profile1.vlt", " " + test.obj_dir + "/profile2.vlt"
+],
+             threads=2)
+
+variation = test.file_grep(test.stats, r'Profile data, mtask cost max variation\s+([0-9.]+)')
+if variation and float(variation[0][0]) <= 0:
+    test.error("Expected nonzero mtask cost variation, got " + variation[0][0])
+test.file_grep(test.stats, r'Profile data, mtasks with high variation\s+([1-9]\d*)')
+
+test.execute()
+
+test.passes()
@@ -0,0 +1,148 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_save.h>
+
+#include <sys/stat.h>
+
+#include <memory>
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+uint64_t main_time = 0;
+int errors = 0;
+std::unique_ptr<VM_PREFIX> topp;
+
+double sc_time_stamp() { return main_time; }
+
+static void write(uint32_t addr, uint32_t data) {
+    topp->we = 1;
+    topp->addr = addr;
+    topp->wdata = data;
+    topp->clk = 0;
+    topp->eval();
+    topp->clk = 1;
+    topp->eval();
+    main_time += 10;
+    topp->we = 0;
+    topp->clk = 0;
+    topp->eval();
+}
+
+static uint32_t read(uint32_t addr) {
+    topp->addr = addr;
+    topp->eval();
+    return topp->rdata;
+}
+
+static void save(VerilatedSaveDiff& os, const std::string& filename) {
+    os.open(filename);
+    TEST_CHECK_EQ(os.isOpen(), true);
+    os << main_time;
+    os << *topp;
+    os.close();
+}
+
+static off_t fileSize(const std::string& filename) {
+    struct stat st;
+    if (::stat(filename.c_str(), &st) != 0) return 0;
+    return st.st_size;
+}
+
+int main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::commandArgs(argc, argv);
+
+    const std::string baseFilename = VL_STRINGIFY(TEST_OBJ_DIR) "/base.vltsave";
+    const std::string diff1Filename = VL_STRINGIFY(TEST_OBJ_DIR) "/diff1.vltsave";
+    const std::string diff2Filename = VL_STRINGIFY(TEST_OBJ_DIR) "/diff2.vltsave";
+    const std::string base2Filename = VL_STRINGIFY(TEST_OBJ_DIR) "/base2.vltsave";
+    const std::string diff3Filename = VL_STRINGIFY(TEST_OBJ_DIR) "/diff3.vltsave";
+
+    topp.reset(new VM_PREFIX{"top"});
+    topp->eval();
+
+    VerilatedSaveDiff os;
+    save(os, baseFilename);
+    write(5, 0x1234);
+    save(os, diff1Filename);
+    write(200000, 0xabcd);
+    save(os, diff2Filename);
+    const uint64_t savedTime = main_time;
+
+    // Changing a few words writes only the blocks holding them
+    TEST_CHECK_NE(fileSize(baseFilename), 0);
+    TEST_CHECK_EQ(fileSize(diff1Filename) < fileSize(baseFilename) / 4, true);
+    TEST_CHECK_EQ(fileSize(diff2Filename) < fileSize(baseFilename) / 4, true);
+
+    write(5, 0x5678);
+    write(200000, 0x9999);
+    write(7, 0x7777);
+    TEST_CHECK_EQ(read(5), 0x5678U);
+
+    {
+        // Restore to the first difference
+        VerilatedRestoreDiff is;
+        is.open({baseFilename, diff1Filename});
+        TEST_CHECK_EQ(is.isOpen(), true);
+        is >> main_time;
+        is >> *topp;
+        is.close();
+        TEST_CHECK_EQ(read(5), 0x1234U);
+        TEST_CHECK_EQ(read(7), 7 * 0x9e3779b9U);
+        TEST_CHECK_EQ(read(200000), 200000 * 0x9e3779b9U);
+    }
+    {
+        // Restore through the second difference
+        VerilatedRestoreDiff is;
+        is.open({baseFilename, diff1Filename, diff2Filename});
+        TEST_CHECK_EQ(is.isOpen(), true);
+        is >> main_time;
+        is >> *topp;
+        is.close();
+        TEST_CHECK_EQ(main_time, savedTime);
+        TEST_CHECK_EQ(read(5), 0x1234U);
+        TEST_CHECK_EQ(read(7), 7 * 0x9e3779b9U);
+        TEST_CHECK_EQ(read(200000), 0xabcdU);
+    }
+    {
+        // After a rebase the next save is complete, and starts a new chain
+        os.rebase();
+        write(9, 0x4242);
+        save(os, base2Filename);
+        write(9, 0x4343);
+        save(os, diff3Filename);
+        TEST_CHECK_EQ(fileSize(base2Filename), fileSize(baseFilename));
+        TEST_CHECK_EQ(fileSize(diff3Filename) < fileSize(base2Filename) / 4, true);
+        write(9, 0);
+        VerilatedRestoreDiff is;
+        is.open({base2Filename, diff3Filename});
+        TEST_CHECK_EQ(is.isOpen(), true);
+        is >> main_time;
+        is >> *topp;
+        is.close();
+        TEST_CHECK_EQ(read(9), 0x4343U);
+        TEST_CHECK_EQ(read(200000), 0xabcdU);
+    }
+    {
+        VerilatedRestoreDiff is;
+        is.open({baseFilename, "/No/such_file_as_this"});
+        TEST_CHECK_EQ(is.isOpen(), false);
+    }
+
+    topp->final();
+    topp.reset();
+
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
@@ -0,0 +1,26 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk,
+    input we,
+    input [17:0] addr,
+    input [31:0] wdata,
+    output [31:0] rdata
+);
+
+  // Large enough state that a difference save is much smaller than the base
+  reg [31:0] mem[0:(1<<18)-1];
+
+  initial begin
+    for (int i = 0; i < (1 << 18); ++i) mem[i] = i * 32'h9e3779b9;
+  end
+
+  always @(posedge clk) if (we) mem[addr] <= wdata;
+
+  assign rdata = mem[addr];
+
+endmodule
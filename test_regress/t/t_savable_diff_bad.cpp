@@ -0,0 +1,71 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_save.h>
+
+#include <memory>
+#include VM_PREFIX_INCLUDE
+
+//======================================================================
+
+uint64_t main_time = 0;
+std::unique_ptr<VM_PREFIX> topp;
+
+double sc_time_stamp() { return main_time; }
+
+static void write(uint32_t addr, uint32_t data) {
+    topp->we = 1;
+    topp->addr = addr;
+    topp->wdata = data;
+    topp->clk = 0;
+    topp->eval();
+    topp->clk = 1;
+    topp->eval();
+    main_time += 10;
+    topp->we = 0;
+    topp->clk = 0;
+    topp->eval();
+}
+
+static void save(VerilatedSaveDiff& os, const std::string& filename) {
+    os.open(filename);
+    os << main_time;
+    os << *topp;
+    os.close();
+}
+
+int main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::commandArgs(argc, argv);
+
+    const std::string baseFilename = VL_STRINGIFY(TEST_OBJ_DIR) "/base.vltsave";
+    const std::string diff1Filename = VL_STRINGIFY(TEST_OBJ_DIR) "/diff1.vltsave";
+    const std::string diff2Filename = VL_STRINGIFY(TEST_OBJ_DIR) "/diff2.vltsave";
+
+    topp.reset(new VM_PREFIX{"top"});
+    topp->eval();
+
+    VerilatedSaveDiff os;
+    save(os, baseFilename);
+    write(5, 0x1234);
+    save(os, diff1Filename);
+    write(200000, 0xabcd);
+    save(os, diff2Filename);
+
+    // Restoring without the first difference would silently lose its blocks
+    VerilatedRestoreDiff is;
+    is.open({baseFilename, diff2Filename});  // Fatal
+    is >> main_time;
+    is >> *topp;
+    is.close();
+
+    topp->final();
+    topp.reset();
+    return 0;
+}
@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_savable_diff.v"
+
+test.compile(v_flags2=["--savable --exe", test.pli_filename], make_main=False)
+
+test.execute(fails=True)
+
+test.file_grep(test.run_log_filename,
+               r"Can't deserialize; file is out of order, or a save between is missing")
+
+test.passes()
@@ -0,0 +1,132 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+#include <verilated.h>
+#include <verilated_save.h>
+
+#include <memory>
+#include VM_PREFIX_INCLUDE
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+
+//======================================================================
+
+uint64_t main_time = 0;
+int errors = 0;
+std::unique_ptr<VM_PREFIX> topp;
+// Saved ahead of the model, so growing it moves every later block
+std::string note;
+
+double sc_time_stamp() { return main_time; }
+
+static void write(uint32_t addr, uint32_t data) {
+    topp->we = 1;
+    topp->addr = addr;
+    topp->wdata = data;
+    topp->clk = 0;
+    topp->eval();
+    topp->clk = 1;
+    topp->eval();
+    main_time += 10;
+    topp->we = 0;
+    topp->clk = 0;
+    topp->eval();
+}
+
+static uint32_t read(uint32_t addr) {
+    topp->addr = addr;
+    topp->eval();
+    return topp->rdata;
+}
+
+static void save(VerilatedSaveDiff& os, const std::string& filename) {
+    os.open(filename);
+    TEST_CHECK_EQ(os.isOpen(), true);
+    os << main_time;
+    os << note;
+    os << *topp;
+    os.close();
+}
+
+static void restore(const std::vector<std::string>& filenames) {
+    VerilatedRestoreDiff is;
+    is.open(filenames);
+    TEST_CHECK_EQ(is.isOpen(), true);
+    is >> main_time;
+    is >> note;
+    is >> *topp;
+    is.close();
+}
+
+int main(int argc, char* argv[]) {
+    Verilated::debug(0);
+    Verilated::commandArgs(argc, argv);
+
+    const std::string baseFilename = VL_STRINGIFY(TEST_OBJ_DIR) "/base.vltsave";
+    const std::string diff1Filename = VL_STRINGIFY(TEST_OBJ_DIR) "/diff1.vltsave";
+    const std::string diff2Filename = VL_STRINGIFY(TEST_OBJ_DIR) "/diff2.vltsave";
+    const std::string diff3Filename = VL_STRINGIFY(TEST_OBJ_DIR) "/diff3.vltsave";
+
+    topp.reset(new VM_PREFIX{"top"});
+    topp->eval();
+
+    VerilatedSaveDiff os;
+    save(os, baseFilename);
+    // Grow by a few bytes, less than a block
+    note = "first";
+    write(5, 0x41);
+    save(os, diff1Filename);
+    // Grow by more than a block
+    note = std::string(100000, 'n');
+    write(200000, 0x42);
+    write(200001, 0x43);
+    save(os, diff2Filename);
+    const uint64_t savedTime = main_time;
+    // Shrink again
+    note = "last";
+    write(7, 0x44);
+    save(os, diff3Filename);
+
+    note = "changed";
+    write(5, 0x5678);
+    write(200000, 0x9999);
+    TEST_CHECK_EQ(topp->hist_len, 6U);
+
+    restore({baseFilename, diff1Filename});
+    TEST_CHECK_EQ(note, std::string{"first"});
+    TEST_CHECK_EQ(topp->hist_len, 1U);
+    TEST_CHECK_EQ(topp->hist_last, 0x41U);
+    TEST_CHECK_EQ(read(5), 0x41U);
+    TEST_CHECK_EQ(read(7), 7 * 0x9e3779b9U);
+    TEST_CHECK_EQ(read(200000), 200000 * 0x9e3779b9U);
+
+    restore({baseFilename, diff1Filename, diff2Filename});
+    TEST_CHECK_EQ(main_time, savedTime);
+    TEST_CHECK_EQ(note, std::string(100000, 'n'));
+    TEST_CHECK_EQ(topp->hist_len, 3U);
+    TEST_CHECK_EQ(topp->hist_last, 0x43U);
+    TEST_CHECK_EQ(read(5), 0x41U);
+    TEST_CHECK_EQ(read(200000), 0x42U);
+    TEST_CHECK_EQ(read(200001), 0x43U);
+    TEST_CHECK_EQ(read(262143), 262143 * 0x9e3779b9U);
+
+    restore({baseFilename, diff1Filename, diff2Filename, diff3Filename});
+    TEST_CHECK_EQ(note, std::string{"last"});
+    TEST_CHECK_EQ(topp->hist_len, 4U);
+    TEST_CHECK_EQ(topp->hist_last, 0x44U);
+    TEST_CHECK_EQ(read(7), 0x44U);
+    TEST_CHECK_EQ(read(200001), 0x43U);
+    TEST_CHECK_EQ(read(262143), 262143 * 0x9e3779b9U);
+
+    topp->final();
+    topp.reset();
+
+    if (!errors) VL_PRINTF("*-* All Finished *-*\n");
+    return errors ? 10 : 0;
+}
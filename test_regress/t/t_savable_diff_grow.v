@@ -0,0 +1,36 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (
+    input clk,
+    input we,
+    input [17:0] addr,
+    input [31:0] wdata,
+    output [31:0] rdata,
+    output [31:0] hist_len,
+    output [7:0] hist_last
+);
+
+  reg [31:0] mem[0:(1<<18)-1];
+  // Grows on every write, so the saved state changes size between saves
+  string hist;
+
+  initial begin
+    for (int i = 0; i < (1 << 18); ++i) mem[i] = i * 32'h9e3779b9;
+  end
+
+  always @(posedge clk) begin
+    if (we) begin
+      mem[addr] <= wdata;
+      hist <= {hist, $sformatf("%c", wdata[7:0])};
+    end
+  end
+
+  assign rdata = mem[addr];
+  assign hist_len = hist.len();
+  assign hist_last = (hist.len() == 0) ? 8'h0 : hist[hist.len()-1];
+
+endmodule
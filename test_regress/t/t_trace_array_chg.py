@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+test.compile(verilator_flags2=['--cc --trace-vcd --trace-max-array 64'])
+
+test.execute()
+
+# Arrays use bulk change detection
+files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.cpp")
+test.file_grep_any(files, r'chgBitArray\(')
+test.file_grep_any(files, r'chgCDataArray\(')
+test.file_grep_any(files, r'chgSDataArray\(')
+test.file_grep_any(files, r'chgIDataArray\(')
+test.file_grep_any(files, r'chgQDataArray\(')
+test.file_grep_any(files, r'chgWDataArray\(')
+
+# Changes in each array are still dumped
+test.vcd_identical(test.trace_filename, test.golden_filename)
+
+test.passes()
@@ -0,0 +1,48 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (clk);
+   input clk;
+   integer cyc = 0;
+
+   // Unpacked arrays of each storage type, longer than a change detection block
+   logic        a1   [0:36];
+   logic [7:0]  a8   [0:36];
+   logic [15:0] a16  [0:36];
+   logic [31:0] a32  [0:36];
+   logic [63:0] a64  [0:36];
+   logic [99:0] a100 [0:36];
+
+   initial begin
+      for (int i = 0; i < 37; ++i) begin
+         a1[i] = '0;
+         a8[i] = '0;
+         a16[i] = '0;
+         a32[i] = '0;
+         a64[i] = '0;
+         a100[i] = '0;
+      end
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      a1[(cyc * 5) % 37] <= ~a1[(cyc * 5) % 37];
+      a8[(cyc * 7 + 1) % 37] <= 8'(cyc * 13 + 1);
+      a16[36 - cyc] <= 16'(cyc * 1000 + 7);
+      if (cyc == 3) begin
+         for (int i = 0; i < 37; ++i) a32[i] <= i * 3 + 1;
+      end
+      else begin
+         a32[cyc] <= 32'hdead0000 + cyc;
+      end
+      a64[(cyc * 11) % 37] <= {32'(cyc), 32'hcafe0000 + cyc};
+      a100[cyc + 30] <= {4'(cyc), 32'(cyc), 32'h12345678, ~32'(cyc)};
+      if (cyc == 5) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
@@ -0,0 +1,40 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+test.top_filename = "t/t_trace_complex.v"
+test.golden_filename = "t/t_trace_complex.out"
+
+test.compile(verilator_flags2=['--cc --trace-vbt'])
+
+test.execute()
+
+test.run(cmd=[os.environ["VERILATOR_ROOT"] + "/bin/verilator_vbt2vcd",
+              "-o", test.obj_dir + "/simx.vcd",
+              test.trace_filename],
+         verilator_run=True)  # yapf:disable
+
+test.vcd_identical(test.obj_dir + "/simx.vcd", test.golden_filename)
+
+# Time window and signal subset
+test.run(cmd=[os.environ["VERILATOR_ROOT"] + "/bin/verilator_vbt2vcd",
+              "--start 22 --end 30 --signal 't\\.cyc$'",
+              "-o", test.obj_dir + "/window.vcd",
+              test.trace_filename],
+         verilator_run=True)  # yapf:disable
+
+test.file_grep(test.obj_dir + "/window.vcd", r' cyc \[31:0\] ')
+test.file_grep_not(test.obj_dir + "/window.vcd", r' v_arrp ')
+test.file_grep(test.obj_dir + "/window.vcd", r'^#22\n')
+test.file_grep(test.obj_dir + "/window.vcd", r'^#30\n')
+test.file_grep_not(test.obj_dir + "/window.vcd", r'^#(20|35)\n')
+
+test.passes()
@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+test.compile(verilator_flags2=['--cc --trace-vcd'])
+
+profile_filename = test.obj_dir + "/trace_profile.txt"
+
+test.execute(all_run_flags=["+verilator+trace+profile+" + profile_filename])
+
+test.file_grep(profile_filename, r'^// Verilator trace profile')
+# The signal toggling every cycle is the hottest, the constant signal is
+# only emitted once
+test.file_grep(profile_filename, r'Bits  Signal\n +\d+ +\d+ +[\d.]+% +128  top\.t\.hot\.busy$')
+test.file_grep(profile_filename, r'^ +1 +1 +[\d.]+% +8  top\.t\.cold\.quiet$')
+# Totals of each scope
+test.file_grep(profile_filename, r'^ +\d+ +\d+ +[\d.]+% +\d+  top\.t\.hot$')
+test.file_grep(profile_filename, r'^ +\d+ +\d+ +[\d.]+% +\d+  top\.t\.cold$')
+
+test.passes()
@@ -0,0 +1,34 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+
+   hot hot (.clk(clk));
+   cold cold (.clk(clk));
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 20) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+module hot (input clk);
+   reg [127:0] busy = 0;
+   always @ (posedge clk) busy <= ~busy;
+endmodule
+
+module cold (input clk);
+   reg [7:0] quiet = 0;
+endmodule
@@ -0,0 +1,26 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+test.compile(verilator_flags2=['--cc --trace-vcd'])
+
+test.execute(all_run_flags=["+verilator+trace+recorder+4"], fails=True)
+
+# Only the last dumps before the $stop are written
+test.file_grep(test.trace_filename, r'\$enddefinitions')
+test.file_grep_not(test.trace_filename, r'^#10$')
+test.file_grep_not(test.trace_filename, r'^b01011010 ')  # early, only set at cyc 2
+# First written dump has the value of all signals
+test.file_grep(test.trace_filename, r'^b00000000 ')  # early
+test.file_grep(test.trace_filename, r'^b00000000000000000000000000010100 ')  # cyc == 20
+
+test.passes()
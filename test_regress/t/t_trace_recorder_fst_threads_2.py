@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+test.top_filename = "t/t_trace_recorder.v"
+
+# Offloaded tracing, so the recorder is replayed into offload buffers
+test.compile(verilator_flags2=['--cc --trace-fst --trace-threads 2'])
+
+test.execute(all_run_flags=["+verilator+trace+recorder+4"], fails=True)
+
+vcd = test.obj_dir + "/simx-fst2vcd.vcd"
+test.fst2vcd(test.trace_filename, vcd)
+
+# Only the last dumps before the $stop are written
+test.file_grep(vcd, r'\$enddefinitions')
+test.file_grep_not(vcd, r'^#10$')
+test.file_grep_not(vcd, r'^b01011010 ')  # early, only set at cyc 2
+# First written dump has the value of all signals
+test.file_grep(vcd, r'^b00000000 ')  # early
+test.file_grep(vcd, r'^b00000000000000000000000000010100 ')  # cyc == 20
+
+test.passes()
@@ -0,0 +1,44 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+test.top_filename = "t/t_trace_array_chg.v"
+
+test.compile(verilator_flags2=['--cc --trace-saif --trace-max-array 64'])
+
+test.execute()
+
+# SAIF activity is accumulated directly by the generated code
+files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*__Trace*.cpp")
+test.file_grep_any(files, r'bufp->togBit\(')
+test.file_grep_any(files, r'bufp->togCData\(')
+test.file_grep_any(files, r'bufp->togSData\(')
+test.file_grep_any(files, r'bufp->togIData\(')
+test.file_grep_any(files, r'bufp->togQData\(')
+test.file_grep_any(files, r'bufp->togWData\(')
+for filename in files:
+    test.file_grep_not(filename, r'bufp->(chg|full)[A-Z]')
+
+# Activity of later words of quad and wide signals lands on the right bits
+test.file_grep(test.trace_filename, r'\(DURATION 60\)')
+test.file_grep(test.trace_filename,
+               r'\(cyc\\\[0\\\] \(T0 30\) \(T1 30\) \(TZ 0\) \(TX 0\) \(TB 0\) \(TC 5\)\)')
+test.file_grep(test.trace_filename,
+               r'\(a64\[11\]\\\[32\\\] \(T0 20\) \(T1 40\) \(TZ 0\) \(TX 0\) \(TB 0\) \(TC 1\)\)')
+test.file_grep(test.trace_filename,
+               r'\(a100\[30\]\\\[35\\\] \(T0 10\) \(T1 50\) \(TZ 0\) \(TX 0\) \(TB 0\) \(TC 1\)\)')
+test.file_grep(test.trace_filename,
+               r'\(a100\[31\]\\\[96\\\] \(T0 20\) \(T1 40\) \(TZ 0\) \(TX 0\) \(TB 0\) \(TC 1\)\)')
+test.file_grep(test.trace_filename,
+               r'\(a100\[31\]\\\[97\\\] \(T0 60\) \(T1 0\) \(TZ 0\) \(TX 0\) \(TB 0\) \(TC 0\)\)')
+
+test.passes()
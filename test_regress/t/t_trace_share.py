@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+test.top_filename = "t/t_trace_scope_no_inline.v"
+test.golden_filename = "t/t_trace_scope_no_inline.out"
+
+test.compile(verilator_flags2=[
+    "--cc --trace-vcd --trace-share -fno-inline --stats t/t_trace_scope_no_inline.vlt"
+])
+
+test.file_grep(test.stats, r'Tracing, Instance trace functions\s+([1-9]\d*)')
+test.file_grep(test.stats, r'Optimizations, Combined CFuncs\s+([1-9]\d*)')
+
+# The three traced instances of 'sub' share a single full dump function body
+nFull = 0
+for filename in test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.cpp"):
+    nFull += len(
+        re.findall(r'^(VL_ATTR_COLD )?void \w+__trace_full__\w+__DOT__sub_[abc]__\d+\(.*\) \{$',
+                   test.file_contents(filename), re.MULTILINE))
+if nFull != 1:
+    test.error("Expected 1 shared full dump function, got " + str(nFull))
+
+test.execute()
+
+# Signal identifiers are assigned in a different order, so compare logically
+test.vcd_identical(test.trace_filename, test.golden_filename)
+
+test.passes()
@@ -0,0 +1,31 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (clk);
+   input clk;
+   integer cyc = 0;
+
+   // Only a few words change each cycle
+   logic [1023:0] sparse = '0;
+   // All words change each cycle
+   logic [255:0] dense = '0;
+   // Every other word changes, giving many short runs of changed words
+   logic [511:0] alternate = '0;
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc != 4) begin
+         sparse[cyc * 32 +: 32] <= 32'(cyc) * 32'h01010101 + 1;
+         if (cyc[0]) sparse[1023 -: 16] <= 16'(cyc);
+         dense <= ~dense ^ {8{32'(cyc)}};
+         if (cyc[0]) alternate <= alternate ^ {8{64'h00000000_ffffffff}};
+      end
+      if (cyc == 8) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
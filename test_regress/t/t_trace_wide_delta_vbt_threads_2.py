@@ -0,0 +1,29 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+test.top_filename = "t/t_trace_wide_delta.v"
+test.golden_filename = "t/t_trace_wide_delta.out"
+
+# Offloaded, so wide signals with few changed words are sent as deltas, and
+# those with many changed words fall back to sending the full value
+test.compile(verilator_flags2=['--cc --trace-vbt --trace-threads 2 --trace-max-width 0'])
+
+test.execute()
+
+test.run(cmd=[os.environ["VERILATOR_ROOT"] + "/bin/verilator_vbt2vcd",
+              "-o", test.obj_dir + "/simx.vcd",
+              test.trace_filename],
+         verilator_run=True)  # yapf:disable
+
+test.vcd_identical(test.obj_dir + "/simx.vcd", test.golden_filename)
+
+test.passes()
@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('simulator')
+
+test.compile(verilator_flags2=['--cc --trace-vcd'])
+
+test.execute(all_run_flags=[
+    "+verilator+trace+start+30", "+verilator+trace+end+100", "+verilator+trace+scope+top.t*",
+    "+verilator+trace+exclude+top.t.sub2*", "+verilator+trace+trigger+top.t.ena"
+])
+
+# Trace functions with no enabled signals are skipped
+files = test.glob_some(test.obj_dir + "/" + test.vm_prefix + "*.cpp")
+test.file_grep_any(files, r'anyEnabled\(')
+
+# Excluded scope is not declared
+test.file_grep(test.trace_filename, r'\$scope module sub1 ')
+test.file_grep_not(test.trace_filename, r'sub2')
+
+# Only times in the window are dumped
+test.file_grep_not(test.trace_filename, r'^#(0|10|15|20|25)$')
+test.file_grep(test.trace_filename, r'^#30$')
+test.file_grep_not(test.trace_filename, r'^#1[0-9][0-9]$')
+
+# Trigger is low while cyc == 5
+test.file_grep_not(test.trace_filename, r'^b00000000000000000000000000000101 ')  # cyc == 5
+
+test.passes()
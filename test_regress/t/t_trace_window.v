@@ -0,0 +1,39 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+   // Used as trace trigger
+   wire    ena /*verilator public_flat_rd*/ = cyc != 5;
+
+   sub sub1 (.clk(clk), .cyc(cyc));
+   sub sub2 (.clk(clk), .cyc(cyc));
+
+   always @ (posedge clk) begin
+      cyc <= cyc + 1;
+      if (cyc == 12) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+endmodule
+
+module sub (/*AUTOARG*/
+   // Inputs
+   clk, cyc
+   );
+   input clk;
+   input integer cyc;
+
+   reg [7:0] count = 0;
+
+   always @ (posedge clk) count <= 8'(cyc * 3);
+endmodule
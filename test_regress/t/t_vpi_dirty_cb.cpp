@@ -0,0 +1,116 @@
+// -*- mode: C++; c-file-style: "cc-mode" -*-
+//*************************************************************************
+//
+// Copyright 2025 by Wilson Snyder. This program is free software; you can
+// redistribute it and/or modify it under the terms of either the GNU
+// Lesser General Public License Version 3 or the Perl Artistic License
+// Version 2.0.
+// SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+//
+//*************************************************************************
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include VM_PREFIX_INCLUDE
+
+#include "vpi_user.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+// These require the above. Comment prevents clang-format moving them
+#include "TestCheck.h"
+#include "TestSimulator.h"
+#include "TestVpi.h"
+
+int errors = 0;
+
+unsigned int main_time = 0;
+
+int nba_callbacks = 0;
+int mem_callbacks = 0;
+
+static int nba_callback(p_cb_data cb_data) {
+    ++nba_callbacks;
+    if (verbose) {
+        vpi_printf(const_cast<char*>("- nba_count changed to %d at %d\n"),
+                   cb_data->value->value.integer, main_time);
+    }
+    TEST_CHECK_EQ(cb_data->value->value.integer, nba_callbacks * 2);
+    return 0;
+}
+
+static int mem_callback(p_cb_data cb_data) {
+    ++mem_callbacks;
+    if (verbose) {
+        vpi_printf(const_cast<char*>("- mem[1] changed to 0x%x at %d\n"),
+                   cb_data->value->value.integer, main_time);
+    }
+    TEST_CHECK_HEX_EQ(cb_data->value->value.integer, 0x12345678);
+    return 0;
+}
+
+static void register_value_cb(vpiHandle vh, int (*cb_rtn)(p_cb_data)) {
+    static s_vpi_time t{vpiSimTime, 0, 0, 0};
+    static s_vpi_value v{vpiIntVal, {0}};
+    t_cb_data cb_data;
+    bzero(&cb_data, sizeof(cb_data));
+    cb_data.reason = cbValueChange;
+    cb_data.cb_rtn = cb_rtn;
+    cb_data.obj = vh;
+    cb_data.time = &t;
+    cb_data.value = &v;
+    TestVpiHandle cbh = vpi_register_cb(&cb_data);
+    TEST_CHECK_NZ(cbh);
+}
+
+double sc_time_stamp() { return main_time; }
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+
+    uint64_t sim_time = 100;
+    contextp->debug(0);
+    contextp->commandArgs(argc, argv);
+
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(),
+                                                        // Note null name - we're flattening it out
+                                                        ""}};
+
+    // Register after initialization, so only changes made by the clock are seen
+    topp->clk = 0;
+    topp->eval();
+
+    TestVpiHandle vh_nba = VPI_HANDLE("nba_count");
+    TEST_CHECK_NZ(vh_nba);
+    register_value_cb(vh_nba, nba_callback);
+    TestVpiHandle vh_mem = VPI_HANDLE("mem");
+    TEST_CHECK_NZ(vh_mem);
+    TestVpiHandle vh_mem1 = vpi_handle_by_index(vh_mem, 1);
+    TEST_CHECK_NZ(vh_mem1);
+    register_value_cb(vh_mem1, mem_callback);
+
+    while (main_time < sim_time && !contextp->gotFinish()) {
+        main_time += 1;
+        if (verbose) VL_PRINTF("Sim Time %d got_error %d\n", main_time, errors);
+        topp->clk = !topp->clk;
+        topp->eval();
+        VerilatedVpi::callValueCbs();
+        if (errors) vl_stop(__FILE__, __LINE__, "TOP-cpp");
+    }
+
+    if (!contextp->gotFinish()) {
+        vl_fatal(__FILE__, __LINE__, "main", "%Error: Timeout; never got a $finish");
+    }
+    topp->final();
+
+    // One change per clock edge, from the flagged nonblocking assignment
+    TEST_CHECK_EQ(nba_callbacks, 9);
+    // And the change made by $readmemh, found by polling
+    TEST_CHECK_EQ(mem_callbacks, 1);
+
+    return errors ? 10 : 0;
+}
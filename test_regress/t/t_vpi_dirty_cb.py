@@ -0,0 +1,24 @@
+#!/usr/bin/env python3
+# DESCRIPTION: Verilator: Verilog Test driver/expect definition
+#
+# Copyright 2025 by Wilson Snyder. This program is free software; you
+# can redistribute it and/or modify it under the terms of either the GNU
+# Lesser General Public License Version 3 or the Perl Artistic License
+# Version 2.0.
+# SPDX-License-Identifier: LGPL-3.0-only OR Artistic-2.0
+
+import vltest_bootstrap
+
+test.scenarios('vlt')
+
+test.compile(make_top_shell=False,
+             make_main=False,
+             verilator_flags2=["--exe --vpi --vpi-dirty --stats", test.pli_filename])
+
+# Only nba_count is flagged, mem is also written by $readmemh so is polled
+test.file_grep(test.stats, r'VPI, Flagged variables\s+(\d+)', 1)
+test.file_grep(test.stats, r'VPI, Flag setters\s+([1-9]\d*)')
+
+test.execute()
+
+test.passes()
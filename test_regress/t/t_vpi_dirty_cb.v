@@ -0,0 +1,35 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t (/*AUTOARG*/
+   // Inputs
+   clk
+   );
+   input clk;
+
+   integer cyc = 0;
+
+   // Only written by nonblocking assignments, so has a value change flag
+   reg [31:0] nba_count /*verilator public_flat_rd*/ = 0;
+   // Also written by $readmemh, so value changes are found by polling
+   reg [31:0] mem [0:1] /*verilator public_flat_rd*/;
+
+   initial begin
+      mem[0] = 0;
+      mem[1] = 0;
+   end
+
+   always @(posedge clk) begin
+      cyc <= cyc + 1;
+      nba_count <= nba_count + 2;
+      if (cyc == 3) $readmemh("t/t_vpi_dirty_cb.mem", mem);
+      if (cyc == 8) begin
+         $write("*-* All Finished *-*\n");
+         $finish;
+      end
+   end
+
+endmodule : t
@@ -0,0 +1,130 @@
+// ======================================================================
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty.
+// SPDX-License-Identifier: CC0-1.0
+// ======================================================================
+
+// DESCRIPTION: VerilatedVpi::groupCreate/groupGet/groupPut bulk access
+
+#include "verilated.h"
+#include "verilated_vpi.h"
+
+#include "TestVpi.h"
+#include "Vt_vpi_group.h"
+
+#include <iostream>
+#include <memory>
+
+static const char* const s_names[] = {"t.a", "t.b", "t.c", "t.d", "t.e", "t.mem"};
+static constexpr int NUM_NAMES = sizeof(s_names) / sizeof(s_names[0]);
+
+// Compare a group member's words against vpi_get_value
+static int checkMember(vpiHandle h, const PLI_UINT32* bufp) {
+    s_vpi_value v;
+    v.format = vpiVectorVal;
+    vpi_get_value(h, &v);
+    const int words = (vpi_get(vpiSize, h) + 31) / 32;
+    for (int i = 0; i < words; ++i) CHECK_RESULT_HEX(bufp[i], v.value.vector[i].aval);
+    return 0;
+}
+
+static int test() {
+    TestVpiHandle handles[NUM_NAMES + 2];
+    for (int i = 0; i < NUM_NAMES; ++i) {
+        handles[i] = vpi_handle_by_name(const_cast<PLI_BYTE8*>(s_names[i]), nullptr);
+        CHECK_RESULT_NZ(handles[i]);
+    }
+    // Element of a packed array, and of an unpacked array
+    handles[NUM_NAMES] = vpi_handle_by_index(handles[4], 2);
+    CHECK_RESULT_NZ(handles[NUM_NAMES]);
+    handles[NUM_NAMES + 1] = vpi_handle_by_index(handles[5], 1);
+    CHECK_RESULT_NZ(handles[NUM_NAMES + 1]);
+
+    // Whole unpacked arrays are not supported
+    Verilated::threadContextp()->fatalOnVpiError(false);
+    {
+        vpiHandle memp = handles[5];
+        TestVpiHandle badp = VerilatedVpi::groupCreate(&memp, 1);
+        CHECK_RESULT_Z(badp);
+        s_vpi_error_info info;
+        CHECK_RESULT_NZ(vpi_chk_error(&info));
+    }
+    Verilated::threadContextp()->fatalOnVpiError(true);
+
+    vpiHandle members[] = {handles[0], handles[1], handles[2], handles[3],
+                           handles[4], handles[NUM_NAMES], handles[NUM_NAMES + 1]};
+    constexpr int NUM_MEMBERS = sizeof(members) / sizeof(members[0]);
+    TestVpiHandle groupp = VerilatedVpi::groupCreate(members, NUM_MEMBERS);
+    CHECK_RESULT_NZ(groupp);
+    // 1 + 1 + 2 + 3 + 1 + 1 + 1
+    CHECK_RESULT(VerilatedVpi::groupWords(groupp), 10);
+
+    PLI_UINT32 buf[10];
+    VerilatedVpi::groupGet(groupp, buf);
+    CHECK_RESULT_HEX(buf[0], 0x5);
+    CHECK_RESULT_HEX(buf[2], 0x345678ff);
+    CHECK_RESULT_HEX(buf[3], 0x12);
+    CHECK_RESULT_HEX(buf[6], 0x3f);
+    CHECK_RESULT_HEX(buf[8], 0xa5);
+    CHECK_RESULT_HEX(buf[9], 0x34);
+    for (int i = 0, word = 0; i < NUM_MEMBERS; ++i) {
+        if (const int err = checkMember(members[i], buf + word)) return err;
+        word += (vpi_get(vpiSize, members[i]) + 31) / 32;
+    }
+
+    // Put all ones, excess bits must be masked
+    for (PLI_UINT32& word : buf) word = 0xffffffff;
+    buf[8] = 0x3c;  // e[2]
+    VerilatedVpi::clearEvalNeeded();
+    VerilatedVpi::groupPut(groupp, buf);
+    CHECK_RESULT_NZ(VerilatedVpi::evalNeeded());
+    PLI_UINT32 got[10];
+    VerilatedVpi::groupGet(groupp, got);
+    CHECK_RESULT_HEX(got[0], 0xf);
+    CHECK_RESULT_HEX(got[1], 0xfff);
+    CHECK_RESULT_HEX(got[3], 0xff);
+    CHECK_RESULT_HEX(got[6], 0x3f);
+    CHECK_RESULT_HEX(got[8], 0x3c);
+    CHECK_RESULT_HEX(got[9], 0xff);
+    {
+        s_vpi_value v;
+        v.format = vpiVectorVal;
+        vpi_get_value(handles[4], &v);  // Other bytes of e unchanged
+        CHECK_RESULT_HEX(v.value.vector[0].aval, 0xff3cffff);
+    }
+
+    // Read-only signals cannot be written
+    {
+        TestVpiHandle rop = vpi_handle_by_name(const_cast<PLI_BYTE8*>("t.ro"), nullptr);
+        CHECK_RESULT_NZ(rop);
+        vpiHandle ro = rop;
+        TestVpiHandle rogroupp = VerilatedVpi::groupCreate(&ro, 1);
+        CHECK_RESULT_NZ(rogroupp);
+        VerilatedVpi::groupGet(rogroupp, got);
+        CHECK_RESULT_HEX(got[0], 0x3);
+        Verilated::threadContextp()->fatalOnVpiError(false);
+        got[0] = 0;
+        VerilatedVpi::groupPut(rogroupp, got);
+        s_vpi_error_info info;
+        CHECK_RESULT_NZ(vpi_chk_error(&info));
+        Verilated::threadContextp()->fatalOnVpiError(true);
+        VerilatedVpi::groupGet(rogroupp, got);
+        CHECK_RESULT_HEX(got[0], 0x3);
+    }
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    const std::unique_ptr<VerilatedContext> contextp{new VerilatedContext};
+    contextp->commandArgs(argc, argv);
+    const std::unique_ptr<VM_PREFIX> topp{new VM_PREFIX{contextp.get(), ""}};
+    topp->eval();
+
+    if (const int err = test()) {
+        std::cout << "%Error: test failed at line " << err << std::endl;
+        return 1;
+    }
+    topp->final();
+    std::cout << "*-* All Finished *-*" << std::endl;
+    return 0;
+}
@@ -0,0 +1,17 @@
+// DESCRIPTION: Verilator: Verilog Test module
+//
+// This file ONLY is placed under the Creative Commons Public Domain, for
+// any use, without warranty, 2025 by Wilson Snyder.
+// SPDX-License-Identifier: CC0-1.0
+
+module t;
+
+  logic [3:0] a  /*verilator public_flat_rw*/ = 4'h5;
+  logic [11:0] b  /*verilator public_flat_rw*/ = 12'habc;
+  logic [39:0] c  /*verilator public_flat_rw*/ = 40'h12_345678ff;
+  logic [69:0] d  /*verilator public_flat_rw*/ = 70'h3f_22222222_11111111;
+  logic [3:0][7:0] e  /*verilator public_flat_rw*/ = 32'ha5a5a5a5;
+  logic [7:0] mem[2]  /*verilator public_flat_rw*/ = '{8'h12, 8'h34};
+  logic [1:0] ro  /*verilator public_flat_rd*/ = 2'h3;
+
+endmodule